@@ -0,0 +1,326 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <clipp.hpp>
+#include <Ark/Ark.hpp>
+
+// count every allocation made by the program, to report the allocations of each benchmark
+
+namespace
+{
+    std::atomic<std::size_t> allocations_count { 0 };
+    std::atomic<std::size_t> allocated_bytes { 0 };
+}
+
+void* operator new(std::size_t size)
+{
+    allocations_count.fetch_add(1, std::memory_order_relaxed);
+    allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+struct Result
+{
+    std::string name;
+    std::string kind;  ///< "run" or "compile"
+    std::vector<double> times;  ///< in milliseconds, one per repetition
+    std::size_t allocations;    ///< per repetition
+    std::size_t bytes;          ///< per repetition
+
+    double percentile(double p) const
+    {
+        std::vector<double> sorted = times;
+        std::sort(sorted.begin(), sorted.end());
+        // nearest rank
+        std::size_t rank = static_cast<std::size_t>(std::ceil(p * sorted.size()));
+        return sorted[rank == 0 ? 0 : rank - 1];
+    }
+};
+
+/**
+ * @brief Run a function warmup + repetitions times, measuring the time and allocations of the repetitions
+ * 
+ * @tparam F 
+ * @param name 
+ * @param kind 
+ * @param warmup 
+ * @param repetitions 
+ * @param function returns false if the benchmark failed
+ * @return Result 
+ */
+template <typename F>
+Result measure(const std::string& name, const std::string& kind, unsigned warmup, unsigned repetitions, F&& function)
+{
+    using clock = std::chrono::steady_clock;
+    Result result { name, kind, {}, 0, 0 };
+
+    for (unsigned i = 0; i < warmup; ++i)
+        function();
+
+    std::size_t start_count = allocations_count.load(), start_bytes = allocated_bytes.load();
+    for (unsigned i = 0; i < repetitions; ++i)
+    {
+        auto start = clock::now();
+        if (!function())
+        {
+            std::cerr << "Benchmark " << name << " failed\n";
+            std::exit(1);
+        }
+        result.times.push_back(std::chrono::duration<double, std::milli>(clock::now() - start).count());
+    }
+    result.allocations = (allocations_count.load() - start_count) / repetitions;
+    result.bytes = (allocated_bytes.load() - start_bytes) / repetitions;
+
+    return result;
+}
+
+struct Throughput
+{
+    std::string name;
+    unsigned threads;
+    double requests_per_second;
+    double speedup;  ///< compared to a single thread
+};
+
+/**
+ * @brief Run the same compiled program on many threads, with a new VM for each request
+ * 
+ * @param state the compiled program, shared by all the VMs
+ * @param threads 
+ * @param requests number of runs per thread
+ * @return double requests per second
+ */
+double throughput(const Ark::State& state, unsigned threads, unsigned requests)
+{
+    using clock = std::chrono::steady_clock;
+    std::atomic<bool> failed { false };
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+
+    auto start = clock::now();
+    for (unsigned t = 0; t < threads; ++t)
+        workers.emplace_back([&state, &failed, requests]() {
+            for (unsigned i = 0; i < requests; ++i)
+            {
+                Ark::VM vm(&state);
+                if (vm.run() != 0)
+                    failed = true;
+            }
+        });
+    for (std::thread& worker : workers)
+        worker.join();
+    double seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+    if (failed)
+    {
+        std::cerr << "Throughput benchmark failed\n";
+        std::exit(1);
+    }
+    return threads * requests / seconds;
+}
+
+/**
+ * @brief Generate a large ArkScript program to benchmark the compiler
+ * 
+ * @param functions number of functions to generate
+ * @return std::string
+ */
+std::string generateSource(unsigned functions)
+{
+    std::stringstream ss;
+    for (unsigned i = 0; i < functions; ++i)
+    {
+        ss << "(let f" << i << " (fun (a b) {\n"
+           << "    (mut c (+ a b " << i << "))\n"
+           << "    (if (> c " << i * 2 << ")\n"
+           << "        (set c (- c 1))\n"
+           << "        (set c (* c 2)))\n"
+           << "    (while (< c 10) (set c (+ 1 c)))\n"
+           << "    [c \"f" << i << "\" (toString c)] }))\n";
+        if (i > 0)
+            ss << "(let r" << i << " (f" << i << " " << i << " (@ (f" << i - 1 << " 1 2) 0)))\n";
+    }
+    return ss.str();
+}
+
+int main(int argc, char** argv)
+{
+    using namespace clipp;
+
+    std::string dir = ARK_BENCHMARKS_DIR, json_output = "", filter = "";
+    unsigned warmup = 2, repetitions = 10, generated_functions = 1000, max_threads = 0;
+    bool help = false;
+
+    auto cli = (
+        option("-h", "--help").set(help).doc("Display this message")
+        , (option("-d", "--dir").doc("Directory holding the ArkScript benchmarks") & value("dir", dir))
+        , (option("-w", "--warmup").doc("Number of runs before measuring (default: 2)") & integer("count", warmup))
+        , (option("-r", "--repetitions").doc("Number of measured runs (default: 10)") & integer("count", repetitions))
+        , (option("-g", "--generated").doc("Number of functions in the generated source given to the compiler (default: 1000)") & integer("count", generated_functions))
+        , (option("-t", "--threads").doc("Measure the throughput of VMs sharing the same State, on 1 to count threads (default: 0, disabled)") & integer("count", max_threads))
+        , (option("-f", "--filter").doc("Only run the benchmarks whose name contains the given text") & value("text", filter))
+        , (option("--json").doc("Write the results as JSON to the given file") & value("file", json_output))
+    );
+
+    if (!parse(argc, argv, cli) || help || repetitions == 0)
+    {
+        std::cout << make_man_page(cli, "ark_bench");
+        return help ? 0 : 1;
+    }
+
+    const std::vector<std::string> corpus = {
+        "ackermann", "fibo", "quicksort", "closures", "strings", "lists", "arrays"
+    };
+    std::vector<Result> results;
+    std::vector<Throughput> throughputs;
+
+    for (const std::string& name : corpus)
+    {
+        if (name.find(filter) == std::string::npos)
+            continue;
+
+        std::string code = Ark::Utils::readFile(dir + "/" + name + ".ark");
+        if (code.empty())
+        {
+            std::cerr << "Couldn't read " << dir << "/" << name << ".ark\n";
+            return 1;
+        }
+
+        results.push_back(measure(name, "compile", warmup, repetitions, [&code]() {
+            Ark::State state;
+            return state.doString(code);
+        }));
+
+        Ark::State state;
+        state.doString(code);
+        Ark::VM vm(&state);
+        results.push_back(measure(name, "run", warmup, repetitions, [&vm]() {
+            return vm.run() == 0;
+        }));
+
+        // 1, 2, 4... threads, and the maximum asked
+        double single_thread = 0.0;
+        for (unsigned threads = 1; threads <= max_threads; threads = (threads < max_threads && threads * 2 > max_threads) ? max_threads : threads * 2)
+        {
+            throughput(state, threads, warmup);
+            double rps = throughput(state, threads, repetitions);
+            if (threads == 1)
+                single_thread = rps;
+            throughputs.push_back({ name, threads, rps, rps / single_thread });
+        }
+    }
+
+    if (std::string("generated").find(filter) != std::string::npos)
+    {
+        std::string code = generateSource(generated_functions);
+        results.push_back(measure("generated", "compile", warmup, repetitions, [&code]() {
+            Ark::State state;
+            return state.doString(code);
+        }));
+    }
+
+    // many small scripts, one per request: a new VM each time vs VMs taken from a pool
+    if (std::string("requests").find(filter) != std::string::npos)
+    {
+        const unsigned requests = 1000;
+        Ark::State state;
+        state.doString("(let double (fun (x) (* x 2)))\n(let r [(double 21) (toString (double 4))])\n");
+
+        results.push_back(measure("requests", "new vm", warmup, repetitions, [&state, requests]() {
+            for (unsigned i = 0; i < requests; ++i)
+            {
+                Ark::VM vm(&state);
+                if (vm.run() != 0)
+                    return false;
+            }
+            return true;
+        }));
+
+        Ark::VMPool pool(state, 1);
+        results.push_back(measure("requests", "pool", warmup, repetitions, [&pool, requests]() {
+            for (unsigned i = 0; i < requests; ++i)
+            {
+                if (pool.acquire()->run() != 0)
+                    return false;
+            }
+            return true;
+        }));
+    }
+
+    std::cout << std::left << std::setw(16) << "benchmark" << std::setw(10) << "kind" << std::right
+              << std::setw(14) << "median (ms)" << std::setw(14) << "p95 (ms)"
+              << std::setw(14) << "allocations" << std::setw(16) << "bytes" << "\n";
+    for (const Result& r : results)
+        std::cout << std::left << std::setw(16) << r.name << std::setw(10) << r.kind << std::right
+                  << std::fixed << std::setprecision(3)
+                  << std::setw(14) << r.percentile(0.5) << std::setw(14) << r.percentile(0.95)
+                  << std::setw(14) << r.allocations << std::setw(16) << r.bytes << "\n";
+
+    if (!throughputs.empty())
+    {
+        std::cout << "\n" << std::left << std::setw(16) << "benchmark" << std::right << std::setw(10) << "threads"
+                  << std::setw(16) << "requests/s" << std::setw(10) << "speedup" << "\n";
+        for (const Throughput& t : throughputs)
+            std::cout << std::left << std::setw(16) << t.name << std::right << std::setw(10) << t.threads
+                      << std::fixed << std::setprecision(1)
+                      << std::setw(16) << t.requests_per_second << std::setw(9) << t.speedup << "x\n";
+    }
+
+    if (!json_output.empty())
+    {
+        std::ofstream out(json_output);
+        out << "{\n  \"version\": \"" << ARK_VERSION_MAJOR << "." << ARK_VERSION_MINOR << "." << ARK_VERSION_PATCH << "\",\n"
+            << "  \"compiler\": \"" << ARK_COMPILER << "\",\n"
+            << "  \"warmup\": " << warmup << ",\n"
+            << "  \"repetitions\": " << repetitions << ",\n"
+            << "  \"results\": [";
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            const Result& r = results[i];
+            out << (i == 0 ? "" : ",") << "\n    { \"name\": \"" << r.name << "\", \"kind\": \"" << r.kind << "\""
+                << std::fixed << std::setprecision(6)
+                << ", \"median_ms\": " << r.percentile(0.5)
+                << ", \"p95_ms\": " << r.percentile(0.95)
+                << ", \"min_ms\": " << *std::min_element(r.times.begin(), r.times.end())
+                << ", \"allocations\": " << r.allocations
+                << ", \"allocated_bytes\": " << r.bytes << " }";
+        }
+        out << "\n  ],\n  \"throughput\": [";
+        for (std::size_t i = 0; i < throughputs.size(); ++i)
+        {
+            const Throughput& t = throughputs[i];
+            out << (i == 0 ? "" : ",") << "\n    { \"name\": \"" << t.name << "\", \"threads\": " << t.threads
+                << std::fixed << std::setprecision(6)
+                << ", \"requests_per_second\": " << t.requests_per_second
+                << ", \"speedup\": " << t.speedup << " }";
+        }
+        out << "\n  ]\n}\n";
+    }
+
+    return 0;
+}
@@ -16,6 +16,7 @@
 #include <Ark/Constants.hpp>
 #include <Ark/Utils.hpp>
 #include <Ark/VM/VM.hpp>
+#include <Ark/VM/VMPool.hpp>
 #include <Ark/Compiler/Compiler.hpp>
 
 #endif  // ark_ark
\ No newline at end of file
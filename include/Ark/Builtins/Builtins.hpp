@@ -39,57 +39,118 @@ namespace Ark::internal::Builtins
     // ------------------------------
     namespace List
     {
-        Value reverseList(std::vector<Value>& n, Ark::VM* vm);   // list:reverse, single arg
-        Value findInList(std::vector<Value>& n, Ark::VM* vm);    // list:find, 2 arguments
-        Value removeAtList(std::vector<Value>& n, Ark::VM* vm);  // list:removeAt, 2 arguments
-        Value sliceList(std::vector<Value>& n, Ark::VM* vm);     // list:slice, 4 arguments
-        Value sort_(std::vector<Value>& n, Ark::VM* vm);         // list:sort, 1 argument
-        Value fill(std::vector<Value>& n, Ark::VM* vm);          // list:fill, 2 arguments
-        Value setListAt(std::vector<Value>& n, Ark::VM* vm);     // list:setAt, 3 arguments
+        Value reverseList(ArgsView n, Ark::VM* vm);   // list:reverse, single arg
+        Value findInList(ArgsView n, Ark::VM* vm);    // list:find, 2 arguments
+        Value removeAtList(ArgsView n, Ark::VM* vm);  // list:removeAt, 2 arguments
+        Value sliceList(ArgsView n, Ark::VM* vm);     // list:slice, 4 arguments
+        Value sort_(ArgsView n, Ark::VM* vm);         // list:sort, 1 argument
+        Value sortBy(ArgsView n, Ark::VM* vm);        // list:sortBy, 2 arguments
+        Value fill(ArgsView n, Ark::VM* vm);          // list:fill, 2 arguments
+        Value setListAt(ArgsView n, Ark::VM* vm);     // list:setAt, 3 arguments
+        // the functions given to the parallel builtins must be pure, they are called on several threads
+        Value parallelMap(ArgsView n, Ark::VM* vm);     // list:pmap, 2 arguments
+        Value parallelFilter(ArgsView n, Ark::VM* vm);  // list:pfilter, 2 arguments
+        Value parallelReduce(ArgsView n, Ark::VM* vm);  // list:preduce, 2 arguments, with an associative function
+    }
+
+    namespace Dictionary
+    {
+        Value dict(ArgsView n, Ark::VM* vm);    // dict, even number of arguments
+        Value get(ArgsView n, Ark::VM* vm);     // dict:get, 2 or 3 arguments
+        Value set(ArgsView n, Ark::VM* vm);     // dict:set, 3 arguments
+        Value has(ArgsView n, Ark::VM* vm);     // dict:has?, 2 arguments
+        Value remove(ArgsView n, Ark::VM* vm);  // dict:remove, 2 arguments
+        Value keys(ArgsView n, Ark::VM* vm);    // dict:keys, 1 argument
+        Value values(ArgsView n, Ark::VM* vm);  // dict:values, 1 argument
+        Value size(ArgsView n, Ark::VM* vm);    // dict:size, 1 argument
+        Value copy(ArgsView n, Ark::VM* vm);    // dict:copy, 1 argument
+    }
+
+    namespace Array
+    {
+        Value array(ArgsView n, Ark::VM* vm);      // array, multiple arguments
+        Value fromList(ArgsView n, Ark::VM* vm);   // array:fromList, 1 argument
+        Value toList(ArgsView n, Ark::VM* vm);     // array:toList, 1 argument
+        Value add(ArgsView n, Ark::VM* vm);        // array:add, 2 arguments
+        Value mul(ArgsView n, Ark::VM* vm);        // array:mul, 2 arguments
+        Value scale(ArgsView n, Ark::VM* vm);      // array:scale, 2 arguments
+        Value sum(ArgsView n, Ark::VM* vm);        // array:sum, 1 argument
+        Value min(ArgsView n, Ark::VM* vm);        // array:min, 1 argument
+        Value max(ArgsView n, Ark::VM* vm);        // array:max, 1 argument
+        Value dot(ArgsView n, Ark::VM* vm);        // array:dot, 2 arguments
+        Value prefixSum(ArgsView n, Ark::VM* vm);  // array:prefixSum, 1 argument
+    }
+
+    namespace Iterator
+    {
+        Value range(ArgsView n, Ark::VM* vm);   // iter:range, 2 or 3 arguments
+        Value next(ArgsView n, Ark::VM* vm);    // iter:next, 1 argument
+        Value done(ArgsView n, Ark::VM* vm);    // iter:done?, 1 argument
+        Value reset(ArgsView n, Ark::VM* vm);   // iter:reset, 1 argument
+        Value toList(ArgsView n, Ark::VM* vm);  // iter:toList, 1 argument
+        Value copy(ArgsView n, Ark::VM* vm);    // iter:copy, 1 argument
     }
 
     namespace IO
     {
-        Value print(std::vector<Value>& n, Ark::VM* vm);        // print, multiple arguments
-        Value puts_(std::vector<Value>& n, Ark::VM* vm);        // puts, multiple arguments
-        Value input(std::vector<Value>& n, Ark::VM* vm);        // input, 0 or 1 argument
-        Value writeFile(std::vector<Value>& n, Ark::VM* vm);    // io:writeFile, 2 or 3 arguments
-        Value readFile(std::vector<Value>& n, Ark::VM* vm);     // io:readFile, 1 argument
-        Value fileExists(std::vector<Value>& n, Ark::VM* vm);   // io:fileExists?, 1 argument
-        Value listFiles(std::vector<Value>& n, Ark::VM* vm);    // io:listFiles, 1 argument
-        Value isDirectory(std::vector<Value>& n, Ark::VM* vm);  // io:isDir?, 1 argument
-        Value makeDir(std::vector<Value>& n, Ark::VM* vm);      // io:makeDir, 1 argument
-        Value removeFiles(std::vector<Value>& n, Ark::VM* vm);  // io:removeFiles, multiple arguments
+        Value print(ArgsView n, Ark::VM* vm);        // print, multiple arguments
+        Value puts_(ArgsView n, Ark::VM* vm);        // puts, multiple arguments
+        Value input(ArgsView n, Ark::VM* vm);        // input, 0 or 1 argument
+        Value writeFile(ArgsView n, Ark::VM* vm);    // io:writeFile, 2 or 3 arguments
+        Value readFile(ArgsView n, Ark::VM* vm);     // io:readFile, 1 argument
+        Value open(ArgsView n, Ark::VM* vm);         // io:open, 1 argument
+        Value readLine(ArgsView n, Ark::VM* vm);     // io:readLine, 1 argument
+        Value readChunk(ArgsView n, Ark::VM* vm);    // io:readChunk, 2 arguments
+        Value close(ArgsView n, Ark::VM* vm);        // io:close, 1 argument
+        Value fileExists(ArgsView n, Ark::VM* vm);   // io:fileExists?, 1 argument
+        Value listFiles(ArgsView n, Ark::VM* vm);    // io:listFiles, 1 argument
+        Value isDirectory(ArgsView n, Ark::VM* vm);  // io:isDir?, 1 argument
+        Value makeDir(ArgsView n, Ark::VM* vm);      // io:makeDir, 1 argument
+        Value removeFiles(ArgsView n, Ark::VM* vm);  // io:removeFiles, multiple arguments
+        Value flush(ArgsView n, Ark::VM* vm);        // io:flush, 0 argument
     }
 
     namespace Time
     {
-        Value timeSinceEpoch(std::vector<Value>& n, Ark::VM* vm);  // time, 0 argument
+        Value timeSinceEpoch(ArgsView n, Ark::VM* vm);  // time, 0 argument
     }
 
     namespace System
     {
-        Value system_(std::vector<Value>& n, Ark::VM* vm);  // sys:exec, 1 argument
-        Value sleep(std::vector<Value>& n, Ark::VM* vm);    // sleep, 1 argument
-        Value exit_(std::vector<Value>& n, Ark::VM* vm);    // sys:exit, 1 argument
+        Value system_(ArgsView n, Ark::VM* vm);  // sys:exec, 1 argument
+        Value sleep(ArgsView n, Ark::VM* vm);    // sleep, 1 argument
+        Value exit_(ArgsView n, Ark::VM* vm);    // sys:exit, 1 argument
+        Value memory(ArgsView n, Ark::VM* vm);   // sys:memory, 0 or 1 argument
+        Value gc(ArgsView n, Ark::VM* vm);       // sys:gc, 0 argument
+    }
+
+    namespace Async
+    {
+        Value spawn(ArgsView n, Ark::VM* vm);      // async:spawn, 1 or more arguments
+        Value await(ArgsView n, Ark::VM* vm);      // async:await, 1 argument
+        Value sleep(ArgsView n, Ark::VM* vm);      // async:sleep, 1 argument
+        Value readFile(ArgsView n, Ark::VM* vm);   // async:readFile, 1 argument
+        Value writeFile(ArgsView n, Ark::VM* vm);  // async:writeFile, 2 arguments
     }
 
     namespace String
     {
-        Value format(std::vector<Value>& n, Ark::VM* vm);       // str:format, multiple arguments
-        Value findSubStr(std::vector<Value>& n, Ark::VM* vm);   // str:find, 2 arguments
-        Value removeAtStr(std::vector<Value>& n, Ark::VM* vm);  // str:removeAt, 2 arguments
+        Value format(ArgsView n, Ark::VM* vm);       // str:format, multiple arguments
+        Value findSubStr(ArgsView n, Ark::VM* vm);   // str:find, 2 arguments
+        Value removeAtStr(ArgsView n, Ark::VM* vm);  // str:removeAt, 2 arguments
+        Value builder(ArgsView n, Ark::VM* vm);      // str:builder, 0 argument
+        Value build(ArgsView n, Ark::VM* vm);        // str:build, 1 argument
     }
 
     namespace Mathematics
     {
-        Value exponential(std::vector<Value>& n, Ark::VM* vm);  // math:exp, 1 argument
-        Value logarithm(std::vector<Value>& n, Ark::VM* vm);    // math:ln, 1 argument
-        Value ceil_(std::vector<Value>& n, Ark::VM* vm);        // math:ceil, 1 argument
-        Value floor_(std::vector<Value>& n, Ark::VM* vm);       // math:floor, 1 argument
-        Value round_(std::vector<Value>& n, Ark::VM* vm);       // math:round, 1 argument
-        Value isnan_(std::vector<Value>& n, Ark::VM* vm);       // math:NaN?, 1 argument
-        Value isinf_(std::vector<Value>& n, Ark::VM* vm);       // math:Inf?, 1 argument
+        Value exponential(ArgsView n, Ark::VM* vm);  // math:exp, 1 argument
+        Value logarithm(ArgsView n, Ark::VM* vm);    // math:ln, 1 argument
+        Value ceil_(ArgsView n, Ark::VM* vm);        // math:ceil, 1 argument
+        Value floor_(ArgsView n, Ark::VM* vm);       // math:floor, 1 argument
+        Value round_(ArgsView n, Ark::VM* vm);       // math:round, 1 argument
+        Value isnan_(ArgsView n, Ark::VM* vm);       // math:NaN?, 1 argument
+        Value isinf_(ArgsView n, Ark::VM* vm);       // math:Inf?, 1 argument
 
         extern const Value pi_;
         extern const Value e_;
@@ -97,12 +158,12 @@ namespace Ark::internal::Builtins
         extern const Value inf_;
         extern const Value nan_;
 
-        Value cos_(std::vector<Value>& n, Ark::VM* vm);   // math:cos, 1 argument
-        Value sin_(std::vector<Value>& n, Ark::VM* vm);   // math:sin, 1 argument
-        Value tan_(std::vector<Value>& n, Ark::VM* vm);   // math:tan, 1 argument
-        Value acos_(std::vector<Value>& n, Ark::VM* vm);  // math:arccos, 1 argument
-        Value asin_(std::vector<Value>& n, Ark::VM* vm);  // math:arcsin, 1 argument
-        Value atan_(std::vector<Value>& n, Ark::VM* vm);  // math:arctan, 1 argument
+        Value cos_(ArgsView n, Ark::VM* vm);   // math:cos, 1 argument
+        Value sin_(ArgsView n, Ark::VM* vm);   // math:sin, 1 argument
+        Value tan_(ArgsView n, Ark::VM* vm);   // math:tan, 1 argument
+        Value acos_(ArgsView n, Ark::VM* vm);  // math:arccos, 1 argument
+        Value asin_(ArgsView n, Ark::VM* vm);  // math:arcsin, 1 argument
+        Value atan_(ArgsView n, Ark::VM* vm);  // math:arctan, 1 argument
     }
 }
 
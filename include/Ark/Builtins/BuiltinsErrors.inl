@@ -10,6 +10,19 @@
 #define IO_READ_ARITY "readFile needs 1 argument: filename"
 #define IO_READ_TE0   "readFile: filename must be a String"
 
+#define IO_OPEN_ARITY "io:open needs 1 argument: filename"
+#define IO_OPEN_TE0   "io:open: filename must be a String"
+
+#define IO_READLINE_ARITY "io:readLine needs 1 argument: file"
+#define IO_READLINE_TE0   "io:readLine: file must be a File given by io:open"
+
+#define IO_READCHUNK_ARITY "io:readChunk needs 2 arguments: file, size"
+#define IO_READCHUNK_TE0   "io:readChunk: file must be a File given by io:open"
+#define IO_READCHUNK_TE1   "io:readChunk: size must be a positive Number"
+
+#define IO_CLOSE_ARITY "io:close needs 1 argument: file"
+#define IO_CLOSE_TE0   "io:close: file must be a File given by io:open"
+
 #define IO_EXISTS_ARITY "fileExists? needs 1 argument: filename"
 #define IO_EXISTS_TE0   "fileExists?: filename must be a String"
 
@@ -25,6 +38,8 @@
 #define IO_RM_ARITY "removeFiles needs at least 1 argument: filename [...]"
 #define IO_RM_TE0   "removeFiles: filename must be a String"
 
+#define IO_FLUSH_ARITY "io:flush needs 0 argument"
+
 // List
 
 #define LIST_REVERSE_ARITY "list:reverse needs 1 argument: list"
@@ -50,6 +65,10 @@
 #define LIST_SORT_ARITY "list:sort needs 1 argument: a list"
 #define LIST_SORT_TE0   "list:sort: list must be a List"
 
+#define LIST_SORTBY_ARITY "list:sortBy needs 2 arguments: list, function"
+#define LIST_SORTBY_TE0   "list:sortBy: list must be a List"
+#define LIST_SORTBY_TE1   "list:sortBy: function must be a Function"
+
 #define LIST_FILL_ARITY "list:fill needs 2 arguments: size, value"
 #define LIST_FILL_TE0   "list:fill: size must be a Number"
 
@@ -57,6 +76,120 @@
 #define LIST_SETAT_TE0   "list:setAt: list must be a List"
 #define LIST_SETAT_TE1   "list:setAt: index must be a Number"
 
+// the functions given to the parallel builtins must be pure, the one given to list:preduce associative as well:
+// they run on several threads, the variables they read outside of their arguments being shared
+#define LIST_PMAP_ARITY "list:pmap needs 2 arguments: list, function"
+#define LIST_PMAP_TE0   "list:pmap: list must be a List or a Range"
+#define LIST_PMAP_TE1   "list:pmap: function must be a Function"
+
+#define LIST_PFILTER_ARITY "list:pfilter needs 2 arguments: list, function"
+#define LIST_PFILTER_TE0   "list:pfilter: list must be a List or a Range"
+#define LIST_PFILTER_TE1   "list:pfilter: function must be a Function"
+
+#define LIST_PREDUCE_ARITY "list:preduce needs 2 arguments: list, function"
+#define LIST_PREDUCE_TE0   "list:preduce: list must be a List or a Range"
+#define LIST_PREDUCE_TE1   "list:preduce: function must be a Function"
+#define LIST_PREDUCE_EMPTY "list:preduce: list can not be empty"
+
+// Dict
+
+#define DICT_ARITY  "dict needs an even number of arguments: key, value, ..."
+#define DICT_KEY_TE "dict: keys must be Numbers (not NaN), Strings, Bools or nil"
+
+#define DICT_GET_ARITY "dict:get needs 2 to 3 arguments: dict, key, [default]"
+#define DICT_GET_TE0   "dict:get: dict must be a Dict"
+#define DICT_GET_TE1   "dict:get: key must be a Number (not NaN), a String, a Bool or nil"
+
+#define DICT_SET_ARITY "dict:set needs 3 arguments: dict, key, value"
+#define DICT_SET_TE0   "dict:set: dict must be a Dict"
+#define DICT_SET_TE1   "dict:set: key must be a Number (not NaN), a String, a Bool or nil"
+#define DICT_SET_CONST "dict:set: can not modify a constant dict (bound with let)"
+
+#define DICT_HAS_ARITY "dict:has? needs 2 arguments: dict, key"
+#define DICT_HAS_TE0   "dict:has?: dict must be a Dict"
+#define DICT_HAS_TE1   "dict:has?: key must be a Number (not NaN), a String, a Bool or nil"
+
+#define DICT_REMOVE_ARITY "dict:remove needs 2 arguments: dict, key"
+#define DICT_REMOVE_TE0   "dict:remove: dict must be a Dict"
+#define DICT_REMOVE_TE1   "dict:remove: key must be a Number (not NaN), a String, a Bool or nil"
+#define DICT_REMOVE_CONST "dict:remove: can not modify a constant dict (bound with let)"
+
+#define DICT_KEYS_ARITY "dict:keys needs 1 argument: dict"
+#define DICT_KEYS_TE0   "dict:keys: dict must be a Dict"
+
+#define DICT_VALUES_ARITY "dict:values needs 1 argument: dict"
+#define DICT_VALUES_TE0   "dict:values: dict must be a Dict"
+
+#define DICT_SIZE_ARITY "dict:size needs 1 argument: dict"
+#define DICT_SIZE_TE0   "dict:size: dict must be a Dict"
+
+#define DICT_COPY_ARITY "dict:copy needs 1 argument: dict"
+#define DICT_COPY_TE0   "dict:copy: dict must be a Dict"
+
+// Array
+
+#define ARRAY_TE "array: arguments must be Numbers"
+
+#define ARRAY_FROMLIST_ARITY "array:fromList needs 1 argument: list"
+#define ARRAY_FROMLIST_TE0   "array:fromList: list must be a List of Numbers"
+
+#define ARRAY_TOLIST_ARITY "array:toList needs 1 argument: array"
+#define ARRAY_TOLIST_TE0   "array:toList: array must be an Array"
+
+#define ARRAY_ADD_ARITY "array:add needs 2 arguments: a, b"
+#define ARRAY_ADD_TE    "array:add: a and b must be Arrays"
+#define ARRAY_ADD_SIZE  "array:add: a and b must have the same size"
+
+#define ARRAY_MUL_ARITY "array:mul needs 2 arguments: a, b"
+#define ARRAY_MUL_TE    "array:mul: a and b must be Arrays"
+#define ARRAY_MUL_SIZE  "array:mul: a and b must have the same size"
+
+#define ARRAY_SCALE_ARITY "array:scale needs 2 arguments: array, factor"
+#define ARRAY_SCALE_TE0   "array:scale: array must be an Array"
+#define ARRAY_SCALE_TE1   "array:scale: factor must be a Number"
+
+#define ARRAY_SUM_ARITY "array:sum needs 1 argument: array"
+#define ARRAY_SUM_TE0   "array:sum: array must be an Array"
+
+#define ARRAY_MIN_ARITY "array:min needs 1 argument: array"
+#define ARRAY_MIN_TE0   "array:min: array must be an Array"
+#define ARRAY_MIN_EMPTY "array:min: array can not be empty"
+
+#define ARRAY_MAX_ARITY "array:max needs 1 argument: array"
+#define ARRAY_MAX_TE0   "array:max: array must be an Array"
+#define ARRAY_MAX_EMPTY "array:max: array can not be empty"
+
+#define ARRAY_DOT_ARITY "array:dot needs 2 arguments: a, b"
+#define ARRAY_DOT_TE    "array:dot: a and b must be Arrays"
+#define ARRAY_DOT_SIZE  "array:dot: a and b must have the same size"
+
+#define ARRAY_PREFIXSUM_ARITY "array:prefixSum needs 1 argument: array"
+#define ARRAY_PREFIXSUM_TE0   "array:prefixSum: array must be an Array"
+
+// Iterator
+
+#define ITER_RANGE_ARITY "iter:range needs 2 or 3 arguments: start, end, [step]"
+#define ITER_RANGE_TE    "iter:range: start, end and step must be finite Numbers"
+#define ITER_RANGE_STEP  "iter:range: step can not be 0"
+#define ITER_RANGE_SIZE  "iter:range: a range can not hold more than 2147483647 numbers"
+
+#define ITER_NEXT_ARITY "iter:next needs 1 argument: range"
+#define ITER_NEXT_TE0   "iter:next: range must be a Range"
+#define ITER_NEXT_CONST "iter:next: can not advance a constant range (bound with let)"
+
+#define ITER_DONE_ARITY "iter:done? needs 1 argument: range"
+#define ITER_DONE_TE0   "iter:done?: range must be a Range"
+
+#define ITER_RESET_ARITY "iter:reset needs 1 argument: range"
+#define ITER_RESET_TE0   "iter:reset: range must be a Range"
+#define ITER_RESET_CONST "iter:reset: can not reset a constant range (bound with let)"
+
+#define ITER_TOLIST_ARITY "iter:toList needs 1 argument: range"
+#define ITER_TOLIST_TE0   "iter:toList: range must be a Range"
+
+#define ITER_COPY_ARITY "iter:copy needs 1 argument: range"
+#define ITER_COPY_TE0   "iter:copy: range must be a Range"
+
 // Mathematics
 
 #define MATH_ARITY(name) (name " needs 1 argument: value")
@@ -76,6 +209,11 @@
 #define STR_RM_TE1   "str:removeAt: index must be a Number"
 #define STR_RM_OOR   "str:removeAt: index out of range"
 
+#define STR_BUILDER_ARITY "str:builder needs 0 argument"
+
+#define STR_BUILD_ARITY "str:build needs 1 argument: builder"
+#define STR_BUILD_TE0   "str:build: builder must be a List of Strings"
+
 // System
 
 #define SYS_SYS_ARITY "sys:exec needs 1 argument: command"
@@ -87,4 +225,28 @@
 #define SYS_EXIT_ARITY  "sys:exit needs 1 argument: exit code"
 #define SYS_EXIT_TE0    "sys:exit: exit code must be a Number"
 
+#define SYS_MEMORY_ARITY   "sys:memory needs 0 or 1 argument: name of the statistic"
+#define SYS_MEMORY_TE0     "sys:memory: name must be a String"
+#define SYS_MEMORY_UNKNOWN "sys:memory: unknown statistic "
+
+#define SYS_GC_ARITY "sys:gc needs 0 argument"
+
+// Async
+
+#define ASYNC_SPAWN_ARITY "async:spawn needs at least 1 argument: function, [arguments...]"
+#define ASYNC_SPAWN_TE0   "async:spawn: function must be a Function"
+
+#define ASYNC_AWAIT_ARITY "async:await needs 1 argument: task"
+#define ASYNC_AWAIT_TE0   "async:await: task must be a Number"
+
+#define ASYNC_SLEEP_ARITY "async:sleep needs 1 argument: duration (milliseconds)"
+#define ASYNC_SLEEP_TE0   "async:sleep: duration must be a Number"
+
+#define ASYNC_READ_ARITY "async:readFile needs 1 argument: filename"
+#define ASYNC_READ_TE0   "async:readFile: filename must be a String"
+
+#define ASYNC_WRITE_ARITY "async:writeFile needs 2 arguments: filename, content"
+#define ASYNC_WRITE_TE0   "async:writeFile: filename must be a String"
+#define ASYNC_WRITE_TE1   "async:writeFile: content must be a String"
+
 // Time
\ No newline at end of file
@@ -61,6 +61,17 @@ namespace Ark
          */
         void compile();
 
+        /**
+         * @brief Compile the code given to the last feed() call into new code pages, without generating bytecode
+         * 
+         * Symbols, values and code pages from the previous calls are kept, thus the new code
+         * can use what was defined before. Used by the REPL to compile only the latest input.
+         * On error, the tables are restored to their state before the call.
+         * 
+         * @return std::size_t the id of the page holding the entry point of the new code
+         */
+        std::size_t compileIncremental();
+
         /**
          * @brief Save generated bytecode to a file
          * 
@@ -75,6 +86,8 @@ namespace Ark
          */
         const bytecode_t& bytecode() noexcept;
 
+        friend class State;
+
     private:
         Parser m_parser;
         Optimizer m_optimizer;
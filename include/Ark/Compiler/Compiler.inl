@@ -46,12 +46,12 @@ inline void Compiler::throwCompilerError(const std::string& message, const inter
 
     if (node.filename() != ARK_NO_NAME_FILE)
     {
-        std::vector<std::string> ctx = Utils::splitString(Utils::readFile(node.filename()), '\n');
+        std::vector<std::string> ctx = Utils::splitString(m_parser.sources()->read(node.filename()), '\n');
 
         for (int i=3; i > -3; --i)
         {
             int iline = static_cast<int>(node.line());
-            if (iline >= i)
+            if (iline >= i && iline - i < static_cast<int>(ctx.size()))
                 // + 1 to display real lines numbers
                 ss << std::setw(5) << (iline - i + 1) << " | " << ctx[iline - i] << "\n";
             if (i == 0)  // line of the error
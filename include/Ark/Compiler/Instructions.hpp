@@ -53,7 +53,11 @@ namespace Ark::internal
             LIST              = 0x12,
             APPEND            = 0x13,
             CONCAT            = 0x14,
-        LAST_COMMAND          = 0x14,
+            APPEND_IN_PLACE   = 0x15,
+            CONCAT_IN_PLACE   = 0x16,
+            SET_AT_IN_PLACE   = 0x17,
+            ERASE_IN_PLACE    = 0x18,
+        LAST_COMMAND          = 0x18,
 
         // NB: when adding an operator, it must be referenced as well under
         // src/VM/Builtins/Builtins.cpp, in the operators table
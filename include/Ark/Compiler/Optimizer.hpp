@@ -16,8 +16,10 @@
 #include <unordered_map>
 #include <string>
 #include <cinttypes>
+#include <memory>
 
 #include <Ark/Compiler/Node.hpp>
+#include <Ark/Compiler/SourceCache.hpp>
 #include <Ark/Exceptions.hpp>
 #include <Ark/Constants.hpp>
 
@@ -33,8 +35,10 @@ namespace Ark
         /**
          * @brief Construct a new Optimizer
          * 
+         * @param options 
+         * @param sources the files read by the parser, to display the errors
          */
-        explicit Optimizer(uint16_t options) noexcept;
+        Optimizer(uint16_t options, std::shared_ptr<internal::SourceCache> sources) noexcept;
 
         /**
          * @brief Send the AST to the optimizer, then run the different optimization strategies on it
@@ -53,6 +57,7 @@ namespace Ark
     private:
         internal::Node m_ast;
         uint16_t m_options;
+        std::shared_ptr<internal::SourceCache> m_sources;
         std::unordered_map<std::string, unsigned> m_symAppearances;
 
         /**
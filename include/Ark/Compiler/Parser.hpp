@@ -19,10 +19,12 @@
 #include <utility>
 #include <cinttypes>
 #include <sstream>
+#include <memory>
 
 #include <Ark/Exceptions.hpp>
 #include <Ark/Compiler/Lexer.hpp>
 #include <Ark/Compiler/Node.hpp>
+#include <Ark/Compiler/SourceCache.hpp>
 
 namespace Ark
 {
@@ -66,6 +68,13 @@ namespace Ark
          */
         const std::vector<std::string>& getImports() const noexcept;
 
+        /**
+         * @brief Return the files read by the parser and the ones it included
+         * 
+         * @return const std::shared_ptr<internal::SourceCache>& 
+         */
+        const std::shared_ptr<internal::SourceCache>& sources() const noexcept;
+
         friend std::ostream& operator<<(std::ostream& os, const Parser& P) noexcept;
 
     private:
@@ -82,6 +91,8 @@ namespace Ark
         std::string m_code;
         // the files included by the "includer" to avoid multiple includes
         std::vector<std::string> m_parent_include;
+        // shared with the parsers of the included files
+        std::shared_ptr<internal::SourceCache> m_sources;
 
         /**
          * @brief Applying syntactic sugar: {...} => (begin...), [...] => (list ...)
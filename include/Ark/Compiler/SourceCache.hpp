@@ -0,0 +1,50 @@
+/**
+ * @file SourceCache.hpp
+ * @author Alexandre Plateau (lexplt.dev@gmail.com)
+ * @brief Source files read during a compilation, shared by the parsers, the optimizer and the compiler
+ * @version 0.1
+ * @date 2021-03-01
+ * 
+ * @copyright Copyright (c) 2021
+ * 
+ */
+
+#ifndef ark_compiler_sourcecache
+#define ark_compiler_sourcecache
+
+#include <string>
+#include <unordered_map>
+
+namespace Ark::internal
+{
+    /**
+     * @brief Keep the content of the source files so that each of them is read once per compilation,
+     *        even when it is needed again to display an error
+     * 
+     */
+    class SourceCache
+    {
+    public:
+        /**
+         * @brief Get the content of a file, reading it the first time only
+         * 
+         * @param filename 
+         * @return const std::string& 
+         */
+        const std::string& read(const std::string& filename);
+
+        /**
+         * @brief Remember the content of a file which was read by someone else
+         * 
+         * @param filename 
+         * @param code 
+         */
+        void add(const std::string& filename, const std::string& code);
+
+    private:
+        // indexed by the canonical relative paths, which are used as the filenames of the nodes
+        std::unordered_map<std::string, std::string> m_files;
+    };
+}
+
+#endif
@@ -0,0 +1,42 @@
+/**
+ * @file Constants.hpp.in
+ * @author Alexandre Plateau (lexplt.dev@gmail.com)
+ * @brief Constants used by ArkScript
+ * @version 0.1
+ * @date 2020-10-27
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+
+#ifndef ark_constants
+#define ark_constants
+
+#define ARK_VERSION_MAJOR 3
+#define ARK_VERSION_MINOR 1
+#define ARK_VERSION_PATCH 0
+#define ARK_VERSION ((ARK_VERSION_MAJOR << 16) + (ARK_VERSION_MINOR << 8) + ARK_VERSION_PATCH)
+#define ARK_COMPILATION_OPTIONS "-Wall -Wextra"
+#define ARK_COMPILER "GNU"
+#define ARK_CACHE_DIRNAME "__arkscript__"
+#define ARK_NO_NAME_FILE "FILE"
+#define ARK_ENABLE_SYSTEM 1
+
+#include <cinttypes>
+
+namespace Ark
+{
+    // VM options
+    constexpr uint16_t FeaturePersist            = 1 << 0;
+    constexpr uint16_t FeatureFunctionArityCheck = 1 << 1;
+    constexpr uint16_t FeatureBufferedOutput     = 1 << 2;
+    // Compiler options
+    constexpr uint16_t FeatureRemoveUnusedVars   = 1 << 4;
+
+    // Default features for the VM x Compiler x Parser
+    constexpr uint16_t DefaultFeatures =
+        FeatureFunctionArityCheck
+        | FeatureRemoveUnusedVars;
+}
+
+#endif  // ark_constants
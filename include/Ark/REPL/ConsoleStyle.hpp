@@ -35,18 +35,35 @@ namespace Ark
         // Functions
             // List
         "append", "concat", "list", "list:reverse",
-        "list:find", "list:removeAt", "list:slice", "list:sort",
-        "list:fill", "list:setAt",
+        "list:find", "list:removeAt", "list:slice", "list:sort", "list:sortBy",
+        "list:fill", "list:setAt", "list:pmap", "list:pfilter", "list:preduce",
+        "append!", "concat!", "list:setAt!", "list:removeAt!",
+            // Dict
+        "dict", "dict:get", "dict:set", "dict:has?",
+        "dict:remove", "dict:keys", "dict:values", "dict:size",
+        "dict:copy",
+            // Array
+        "array", "array:fromList", "array:toList", "array:add",
+        "array:mul", "array:scale", "array:sum", "array:min",
+        "array:max", "array:dot", "array:prefixSum",
+            // Iterator
+        "iter:range", "iter:next", "iter:done?", "iter:reset",
+        "iter:toList", "iter:copy",
             // IO
         "print", "puts", "input", "io:writeFile",
         "io:readFile", "io:fileExists?", "io:listFiles", "io:dir?",
-        "io:makeDir", "io:removeFiles",
+        "io:makeDir", "io:removeFiles", "io:flush", "io:open",
+        "io:readLine", "io:readChunk", "io:close",
             // Times
         "time",
             // System
-        "sys:exec", "sys:sleep",
+        "sys:exec", "sys:sleep", "sys:memory", "sys:gc",
+            // Async
+        "async:spawn", "async:await", "async:sleep", "async:readFile",
+        "async:writeFile",
             // String
         "str:format", "str:find", "str:removeAt",
+        "str:builder", "str:append!", "str:build",
             // Mathematics
         "math:exp", "math:ln", "math:ceil", "math:floor",
         "math:round", "math:NaN?", "Inf?", "math:cos", 
@@ -117,8 +134,43 @@ namespace Ark
         {"list:removeAt", Replxx::Color::BRIGHTGREEN},
         {"list:slice", Replxx::Color::BRIGHTGREEN},
         {"list:sort", Replxx::Color::BRIGHTGREEN},
+        {"list:sortBy", Replxx::Color::BRIGHTGREEN},
         {"list:fill", Replxx::Color::BRIGHTGREEN},
         {"list:setAt", Replxx::Color::BRIGHTGREEN},
+        {"list:pmap", Replxx::Color::BRIGHTGREEN},
+        {"list:pfilter", Replxx::Color::BRIGHTGREEN},
+        {"list:preduce", Replxx::Color::BRIGHTGREEN},
+        {"append!", Replxx::Color::BRIGHTGREEN},
+        {"concat!", Replxx::Color::BRIGHTGREEN},
+        {"list:setAt!", Replxx::Color::BRIGHTGREEN},
+        {"list:removeAt!", Replxx::Color::BRIGHTGREEN},
+            // Dict
+        {"dict", Replxx::Color::BRIGHTGREEN},
+        {"dict:get", Replxx::Color::BRIGHTGREEN},
+        {"dict:set", Replxx::Color::BRIGHTGREEN},
+        {"dict:has?", Replxx::Color::BRIGHTGREEN},
+        {"dict:remove", Replxx::Color::BRIGHTGREEN},
+        {"dict:keys", Replxx::Color::BRIGHTGREEN},
+        {"dict:values", Replxx::Color::BRIGHTGREEN},
+        {"dict:size", Replxx::Color::BRIGHTGREEN},
+            // Array
+        {"array", Replxx::Color::BRIGHTGREEN},
+        {"array:fromList", Replxx::Color::BRIGHTGREEN},
+        {"array:toList", Replxx::Color::BRIGHTGREEN},
+        {"array:add", Replxx::Color::BRIGHTGREEN},
+        {"array:mul", Replxx::Color::BRIGHTGREEN},
+        {"array:scale", Replxx::Color::BRIGHTGREEN},
+        {"array:sum", Replxx::Color::BRIGHTGREEN},
+        {"array:min", Replxx::Color::BRIGHTGREEN},
+        {"array:max", Replxx::Color::BRIGHTGREEN},
+        {"array:dot", Replxx::Color::BRIGHTGREEN},
+        {"array:prefixSum", Replxx::Color::BRIGHTGREEN},
+            // Iterator
+        {"iter:range", Replxx::Color::BRIGHTGREEN},
+        {"iter:next", Replxx::Color::BRIGHTGREEN},
+        {"iter:done?", Replxx::Color::BRIGHTGREEN},
+        {"iter:reset", Replxx::Color::BRIGHTGREEN},
+        {"iter:toList", Replxx::Color::BRIGHTGREEN},
             // IO
         {"print", Replxx::Color::GREEN},
         {"puts", Replxx::Color::GREEN},
@@ -130,15 +182,31 @@ namespace Ark
         {"io:dir?", Replxx::Color::GREEN},
         {"io:makeDir", Replxx::Color::GREEN},
         {"io:removeFiles", Replxx::Color::GREEN},
+        {"io:flush", Replxx::Color::GREEN},
+        {"io:open", Replxx::Color::GREEN},
+        {"io:readLine", Replxx::Color::GREEN},
+        {"io:readChunk", Replxx::Color::GREEN},
+        {"io:close", Replxx::Color::GREEN},
             // Times
         {"time", Replxx::Color::GREEN},
             // System
         {"sys:exec", Replxx::Color::GREEN},
         {"sys:sleep", Replxx::Color::GREEN},
+        {"sys:memory", Replxx::Color::GREEN},
+        {"sys:gc", Replxx::Color::GREEN},
+            // Async
+        {"async:spawn", Replxx::Color::GREEN},
+        {"async:await", Replxx::Color::GREEN},
+        {"async:sleep", Replxx::Color::GREEN},
+        {"async:readFile", Replxx::Color::GREEN},
+        {"async:writeFile", Replxx::Color::GREEN},
             // String
         {"str:format", Replxx::Color::BRIGHTGREEN},
         {"str:find", Replxx::Color::BRIGHTGREEN},
         {"str:removeAt", Replxx::Color::BRIGHTGREEN},
+        {"str:builder", Replxx::Color::BRIGHTGREEN},
+        {"str:append!", Replxx::Color::BRIGHTGREEN},
+        {"str:build", Replxx::Color::BRIGHTGREEN},
             // Mathematics
         {"math:exp", Replxx::Color::BRIGHTCYAN},
         {"math:ln", Replxx::Color::BRIGHTCYAN},
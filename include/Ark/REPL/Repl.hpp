@@ -44,7 +44,6 @@ namespace Ark
         uint16_t m_options;
         Replxx m_repl;
         unsigned m_lines;
-        int m_old_ip;
 
         inline void print_repl_header();
         int count_open_parentheses(const std::string& line);
@@ -13,6 +13,7 @@
 #define ark_utils
 
 #include <string>
+#include <string_view>
 #include <sstream>
 #include <iostream>
 #include <streambuf>
@@ -164,15 +165,7 @@ namespace Ark::Utils
      * @param name the file name
      * @return std::string 
      */
-    inline std::string readFile(const std::string& name)
-    {
-        std::ifstream f(name.c_str());
-        // admitting the file exists
-        return std::string(
-            (std::istreambuf_iterator<char>(f)),
-            std::istreambuf_iterator<char>()
-        );
-    }
+    std::string readFile(const std::string& name);
 
     /**
      * @brief Get the directory from a path
@@ -224,6 +217,21 @@ namespace Ark::Utils
      * @return int 
      */
     int dig_places(double d);
+
+    /**
+     * @brief Size of the buffer needed by formatNumber
+     * 
+     */
+    constexpr std::size_t NumberBufferSize = 32;
+
+    /**
+     * @brief Write the shortest representation of a number which reads back as the same number
+     * 
+     * @param d 
+     * @param buffer at least NumberBufferSize characters
+     * @return std::string_view the characters written in the buffer
+     */
+    std::string_view formatNumber(double d, char* buffer) noexcept;
 }
 
 #endif  // ark_utils
\ No newline at end of file
@@ -0,0 +1,203 @@
+/**
+ * @file Dict.hpp
+ * @author Alexandre Plateau (lexplt.dev@gmail.com)
+ * @brief Subtype of the value type, handling dictionaries
+ * @version 0.1
+ * @date 2021-02-20
+ * 
+ * @copyright Copyright (c) 2021
+ * 
+ */
+
+#ifndef ark_vm_dict
+#define ark_vm_dict
+
+#include <vector>
+#include <cinttypes>
+#include <iostream>
+#include <memory>
+
+#include <Ark/VM/Value.hpp>
+
+namespace Ark::internal
+{
+    /**
+     * @brief A hash table from Numbers, Strings, Bools or nil to any value
+     * 
+     * The entries are stored in insertion order, and an open addressing table (linear probing)
+     * gives the index of the entry for each hash. Iterating on the dictionary is thus
+     * as fast as iterating on a list, and gives the keys in a predictable order.
+     * A dictionary is shared by all the values copied from it. The copies of the dictionary itself
+     * (made for the constants, see VM::unshareObject, and by dict:copy) share the entries until one of them is modified.
+     */
+    class Dict
+    {
+    public:
+        /**
+         * @brief Construct a new empty Dict object
+         * 
+         */
+        Dict();
+
+        /**
+         * @brief Construct a new Dict object sharing the entries of another one, until one of them is modified
+         * 
+         */
+        Dict(const Dict&) = default;
+
+        /**
+         * @brief Check if a value can be used as a key (NaN can not, it isn't equal to itself)
+         * 
+         * @param key 
+         * @return true 
+         * @return false 
+         */
+        static bool isHashable(const Value& key) noexcept;
+
+        /**
+         * @brief Find the value associated to a key
+         * 
+         * @param key 
+         * @return const Value* nullptr if the key isn't in the dictionary
+         */
+        const Value* find(const Value& key) const noexcept;
+
+        /**
+         * @brief Associate a value to a key, replacing the previous one if any
+         * 
+         * @param key must be hashable
+         * @param value 
+         */
+        void set(const Value& key, Value value);
+
+        /**
+         * @brief Remove a key and its value
+         * 
+         * @param key 
+         * @return true if the key was in the dictionary
+         * @return false 
+         */
+        bool remove(const Value& key);
+
+        /**
+         * @brief Remove all the keys and values, used by the garbage collector to break the cycles
+         * 
+         */
+        void clear();
+
+        /**
+         * @brief Return the number of keys
+         * 
+         * @return std::size_t 
+         */
+        inline std::size_t size() const noexcept { return m_table->size; }
+
+        /**
+         * @brief Return the keys, in insertion order
+         * 
+         * @return std::vector<Value> 
+         */
+        std::vector<Value> keys() const;
+
+        /**
+         * @brief Return the values, in insertion order
+         * 
+         * @return std::vector<Value> 
+         */
+        std::vector<Value> values() const;
+
+        /**
+         * @brief Call a function on each key and value, in insertion order
+         * 
+         * @tparam F 
+         * @param function called with (const Value& key, const Value& value)
+         */
+        template <typename F>
+        void forEach(F&& function) const
+        {
+            for (const Entry& entry : m_table->entries)
+            {
+                if (entry.key.valueType() != ValueType::Undefined)
+                    function(entry.key, entry.value);
+            }
+        }
+
+        /**
+         * @brief Return the memory reserved by the entries, without the memory of the keys and values
+         * 
+         * @return std::size_t 
+         */
+        std::size_t reservedBytes() const noexcept;
+
+        /**
+         * @brief Identify the entries, which can be shared by multiple dictionaries
+         * 
+         * @return const void* 
+         */
+        inline const void* entries() const noexcept { return m_table.get(); }
+
+        /**
+         * @brief Check if other dictionaries share the entries
+         * 
+         * @return true 
+         * @return false 
+         */
+        inline bool sharesEntries() const noexcept { return m_table.use_count() > 1; }
+
+        friend bool operator==(const Dict& A, const Dict& B) noexcept;
+        friend std::ostream& operator<<(std::ostream& os, const Dict& D) noexcept;
+
+    private:
+        struct Entry
+        {
+            Value key;  ///< Undefined once removed
+            Value value;
+            std::size_t hash;
+        };
+
+        static constexpr int32_t Empty = -1;
+        static constexpr int32_t Deleted = -2;
+
+        struct Table
+        {
+            std::vector<Entry> entries;
+            std::vector<int32_t> indices;  ///< power of 2 sized, index of an entry or Empty/Deleted
+            std::size_t size = 0;
+        };
+
+        std::shared_ptr<Table> m_table;
+
+        /**
+         * @brief Give the dictionary its own entries before modifying them, if they are shared
+         * 
+         * @return Table& 
+         */
+        Table& table();
+
+        /**
+         * @brief Compute the hash of a key, equal keys have the same hash
+         * 
+         * @param key 
+         * @return std::size_t 
+         */
+        static std::size_t hash(const Value& key) noexcept;
+
+        /**
+         * @brief Find the slot of the indices table holding a key
+         * 
+         * @param key 
+         * @param hash 
+         * @return std::size_t the slot, or the size of the indices table if the key isn't in the dictionary
+         */
+        std::size_t findSlot(const Value& key, std::size_t hash) const noexcept;
+
+        /**
+         * @brief Drop the removed entries and rebuild the indices table, for a given number of keys
+         * 
+         * @param capacity 
+         */
+        void rehash(std::size_t capacity);
+    };
+}
+
+#endif
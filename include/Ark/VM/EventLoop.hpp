@@ -0,0 +1,106 @@
+/**
+ * @file EventLoop.hpp
+ * @author Alexandre Plateau (lexplt.dev@gmail.com)
+ * @brief Wait for the timers and I/O operations of the suspended tasks
+ * @version 0.1
+ * @date 2021-02-19
+ * 
+ * @copyright Copyright (c) 2021
+ * 
+ */
+
+#ifndef ark_vm_eventloop
+#define ark_vm_eventloop
+
+#include <map>
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <utility>
+#include <functional>
+#include <condition_variable>
+
+#include <Ark/VM/Value.hpp>
+
+namespace Ark::internal
+{
+    /**
+     * @brief The events the tasks of a VM are waiting for
+     * 
+     * The timers are handled by the thread waiting for the events, the I/O operations are run
+     * one after another on a single helper thread, started with the first operation: the regular
+     * files can't be polled, and it works the same way on every platform.
+     * Only submit can be called from another thread.
+     */
+    class EventLoop
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+        using Operation = std::function<Value()>;
+
+        EventLoop() noexcept;
+
+        /**
+         * @brief Destroy the Event Loop object, waiting for the current I/O operation to finish
+         * 
+         */
+        ~EventLoop();
+
+        EventLoop(const EventLoop&) = delete;
+        EventLoop& operator=(const EventLoop&) = delete;
+
+        /**
+         * @brief Resume a task at a given time, with nil
+         * 
+         * @param task 
+         * @param deadline 
+         */
+        void addTimer(std::size_t task, Clock::time_point deadline);
+
+        /**
+         * @brief Run an operation on the I/O thread, and resume a task with its result
+         * 
+         * If the operation throws, the task is resumed with nil.
+         * 
+         * @param task 
+         * @param operation 
+         */
+        void submit(std::size_t task, Operation operation);
+
+        /**
+         * @brief Check if some timers or operations aren't finished yet
+         * 
+         * @return true 
+         * @return false 
+         */
+        bool pending() const;
+
+        /**
+         * @brief Wait for at least one event, if some are pending
+         * 
+         * @return std::vector<std::pair<std::size_t, Value>> the tasks to resume, with their results
+         */
+        std::vector<std::pair<std::size_t, Value>> wait();
+
+        /**
+         * @brief Forget the timers and results not handled yet, the current operations are still finished
+         * 
+         */
+        void clear();
+
+    private:
+        std::multimap<Clock::time_point, std::size_t> m_timers;
+        std::deque<std::pair<std::size_t, Operation>> m_operations;
+        std::vector<std::pair<std::size_t, Value>> m_completed;
+        std::size_t m_in_flight;  ///< operations submitted but not completed
+        mutable std::mutex m_mutex;
+        std::condition_variable m_wake_up;  ///< an operation was submitted, or the loop is stopped
+        std::condition_variable m_done;     ///< an operation was completed
+        std::thread m_worker;
+        bool m_stop;
+    };
+}
+
+#endif
@@ -76,6 +76,34 @@ namespace Ark::internal
          */
         inline void push(Value&& value) noexcept;
 
+        /**
+         * @brief Return the value on top of the stack, without popping it
+         * 
+         * @return Value* 
+         */
+        inline Value* peek() noexcept;
+
+        /**
+         * @brief Get a view over the values on top of the stack, from the deepest one to the top one
+         * 
+         * @param count number of values
+         * @return ArgsView 
+         */
+        inline ArgsView top(uint16_t count) noexcept;
+
+        /**
+         * @brief Remove values from the top of the stack
+         * 
+         * @param count number of values to remove
+         */
+        inline void drop(uint16_t count) noexcept;
+
+        /**
+         * @brief Empty the stack, keeping the memory reserved for it, and forget the caller
+         * 
+         */
+        void reset() noexcept;
+
         // getters-setters (misc)
 
         /**
@@ -134,6 +162,8 @@ namespace Ark::internal
         inline uint8_t scopeCountToDelete() const noexcept;
 
         friend std::ostream& operator<<(std::ostream& os, const Frame& F) noexcept;
+        friend class Ark::VM;
+        friend class ArgsView;
 
     private:
         //              IP,          PP    EXC_PP
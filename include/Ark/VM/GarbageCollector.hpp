@@ -0,0 +1,132 @@
+/**
+ * @file GarbageCollector.hpp
+ * @author Alexandre Plateau (lexplt.dev@gmail.com)
+ * @brief Collect the cycles of scopes, closures and dictionaries, which can not be freed by the shared pointers
+ * @version 0.1
+ * @date 2021-02-16
+ * 
+ * @copyright Copyright (c) 2021
+ * 
+ */
+
+#ifndef ark_vm_garbagecollector
+#define ark_vm_garbagecollector
+
+#include <vector>
+#include <memory>
+#include <cinttypes>
+
+#include <Ark/VM/Value.hpp>
+#include <Ark/VM/Scope.hpp>
+
+namespace Ark
+{
+    /**
+     * @brief Statistics of the garbage collector of a VM
+     * 
+     */
+    struct GCStats
+    {
+        std::size_t collections = 0;      ///< number of collections
+        std::size_t collected = 0;        ///< number of scopes and dictionaries freed by all the collections
+        std::size_t last_collected = 0;   ///< number of scopes and dictionaries freed by the last collection
+        std::size_t tracked = 0;          ///< number of scopes and dictionaries tracked, ie environments of closures and dictionaries
+        std::size_t threshold = 0;        ///< minimum number of tracked objects to trigger a collection, 0 if disabled
+        std::size_t next_collection = 0;  ///< number of tracked objects which will trigger the next collection
+    };
+}
+
+namespace Ark::internal
+{
+    /**
+     * @brief Find and break the cycles of scopes, closures and dictionaries
+     * 
+     * A closure holds a shared pointer to its scope, which can hold the closure itself
+     * (or other closures pointing back to it), thus those scopes are never freed. The same goes
+     * for a dictionary holding itself, or a closure capturing it.
+     * The environments of the closures and the dictionaries are tracked, and each collection counts
+     * the references to them coming from the other tracked objects: if one has more references than that,
+     * it is used by the VM (stack, locals) or the host program, and everything it can reach
+     * is kept. The others are only referenced by cycles, they are emptied to free them.
+     */
+    class GarbageCollector
+    {
+    public:
+        /**
+         * @brief Construct a new Garbage Collector object
+         * 
+         * @param threshold minimum number of tracked scopes to trigger a collection, 0 to disable the automatic collections
+         */
+        explicit GarbageCollector(std::size_t threshold=4096) noexcept;
+
+        /**
+         * @brief Destroy the Garbage Collector object, collecting the remaining cycles
+         * 
+         */
+        ~GarbageCollector();
+
+        /**
+         * @brief Track the environment of a new closure
+         * 
+         * @param scope 
+         */
+        inline void track(const Scope_t& scope);
+
+        /**
+         * @brief Track a new dictionary
+         * 
+         * @param dict 
+         */
+        inline void track(const std::shared_ptr<Dict>& dict);
+
+        /**
+         * @brief Check if enough scopes and dictionaries were tracked to trigger a collection
+         * 
+         * @return true 
+         * @return false 
+         */
+        inline bool shouldCollect() const noexcept;
+
+        /**
+         * @brief Free the tracked scopes and dictionaries only reachable through cycles
+         * 
+         * @return std::size_t number of scopes and dictionaries freed
+         */
+        std::size_t collect();
+
+        /**
+         * @brief Set the minimum number of tracked scopes and dictionaries to trigger a collection
+         * 
+         * @param threshold 0 to disable the automatic collections
+         */
+        void setThreshold(std::size_t threshold) noexcept;
+
+        /**
+         * @brief Get the statistics of the collector
+         * 
+         * @return GCStats 
+         */
+        GCStats stats() const noexcept;
+
+    private:
+        std::vector<std::weak_ptr<Scope>> m_tracked;
+        std::vector<std::weak_ptr<Dict>> m_tracked_dicts;
+        std::size_t m_threshold;
+        std::size_t m_next_collection;
+        GCStats m_stats;
+
+        /**
+         * @brief Call a function on the scope of each closure and on each dictionary held by a value, looking inside the lists
+         * 
+         * @tparam F 
+         * @param value 
+         * @param function 
+         */
+        template <typename F>
+        static void forEachReference(const Value& value, F&& function);
+    };
+
+    #include "inline/GarbageCollector.inl"
+}
+
+#endif
@@ -0,0 +1,106 @@
+/**
+ * @file Kernels.hpp
+ * @author Alexandre Plateau (lexplt.dev@gmail.com)
+ * @brief Vectorized operations on packed arrays of doubles, used by the Array builtins
+ * @version 0.1
+ * @date 2021-02-22
+ * 
+ * @copyright Copyright (c) 2021
+ * 
+ */
+
+#ifndef ark_vm_kernels
+#define ark_vm_kernels
+
+#include <cinttypes>
+#include <string>
+
+namespace Ark::internal::kernels
+{
+    /**
+     * @brief Return the name of the instruction set used by the kernels on this machine
+     * @details AVX is selected at runtime when the CPU supports it, SSE2 is always available on x86-64,
+     *          and the other architectures use the scalar version
+     * 
+     * @return const std::string& "avx", "sse2" or "scalar"
+     */
+    const std::string& instructionSet() noexcept;
+
+    /**
+     * @brief out[i] = a[i] + b[i]
+     * 
+     * @param a 
+     * @param b 
+     * @param out can be a or b
+     * @param n number of elements
+     */
+    void add(const double* a, const double* b, double* out, std::size_t n) noexcept;
+
+    /**
+     * @brief out[i] = a[i] * b[i]
+     * 
+     * @param a 
+     * @param b 
+     * @param out can be a or b
+     * @param n number of elements
+     */
+    void mul(const double* a, const double* b, double* out, std::size_t n) noexcept;
+
+    /**
+     * @brief out[i] = a[i] * k
+     * 
+     * @param a 
+     * @param k 
+     * @param out can be a
+     * @param n number of elements
+     */
+    void scale(const double* a, double k, double* out, std::size_t n) noexcept;
+
+    /**
+     * @brief Sum of the elements, the additions are done in a different order than a sequential loop
+     * 
+     * @param a 
+     * @param n number of elements
+     * @return double 0 if n is 0
+     */
+    double sum(const double* a, std::size_t n) noexcept;
+
+    /**
+     * @brief Smallest element, NaN if one of the elements is NaN
+     * 
+     * @param a 
+     * @param n number of elements, must not be 0
+     * @return double 
+     */
+    double min(const double* a, std::size_t n) noexcept;
+
+    /**
+     * @brief Greatest element, NaN if one of the elements is NaN
+     * 
+     * @param a 
+     * @param n number of elements, must not be 0
+     * @return double 
+     */
+    double max(const double* a, std::size_t n) noexcept;
+
+    /**
+     * @brief Sum of the a[i] * b[i]
+     * 
+     * @param a 
+     * @param b 
+     * @param n number of elements
+     * @return double 0 if n is 0
+     */
+    double dot(const double* a, const double* b, std::size_t n) noexcept;
+
+    /**
+     * @brief out[i] = a[0] + ... + a[i]
+     * 
+     * @param a 
+     * @param out can be a
+     * @param n number of elements
+     */
+    void prefixSum(const double* a, double* out, std::size_t n) noexcept;
+}
+
+#endif
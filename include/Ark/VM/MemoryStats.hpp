@@ -0,0 +1,60 @@
+/**
+ * @file MemoryStats.hpp
+ * @author Alexandre Plateau (lexplt.dev@gmail.com)
+ * @brief Memory used by a virtual machine
+ * @version 0.1
+ * @date 2021-02-14
+ * 
+ * @copyright Copyright (c) 2021
+ * 
+ */
+
+#ifndef ark_vm_memorystats
+#define ark_vm_memorystats
+
+#include <vector>
+#include <string>
+#include <utility>
+#include <iostream>
+
+namespace Ark
+{
+    /**
+     * @brief Memory footprint of a VM
+     * 
+     * The live part is computed by walking the stacks, scopes, lists and closures of the VM
+     * when requested, the counters and high-water marks are updated during the execution
+     * and reset each time the VM is initialized.
+     */
+    struct MemoryStats
+    {
+        // live memory, each scope is counted once even if it is shared by multiple closures
+        std::size_t values = 0;        ///< values held by the stacks, scopes and lists
+        std::size_t list_bytes = 0;    ///< memory reserved by the lists, arrays and dictionaries for their elements
+        std::size_t string_bytes = 0;  ///< characters held by the strings
+        std::size_t scopes = 0;
+        std::size_t scope_bytes = 0;   ///< including the memory reserved for the variables
+        std::size_t frames = 0;
+        std::size_t frame_bytes = 0;   ///< including the memory reserved for the stacks
+        std::size_t closures = 0;
+
+        // since the VM was initialized
+        std::size_t frames_created = 0;
+        std::size_t scopes_created = 0;
+        std::size_t closures_created = 0;
+        std::size_t dicts_created = 0;   ///< by the builtins, the dictionaries are shared by their copies
+        std::size_t max_frames = 0;  ///< high-water mark of the call stack depth
+        std::size_t max_locals = 0;  ///< high-water mark of the number of scopes
+
+        /**
+         * @brief Return the name and value of each statistic
+         * 
+         * @return std::vector<std::pair<std::string, std::size_t>> 
+         */
+        std::vector<std::pair<std::string, std::size_t>> fields() const;
+
+        friend std::ostream& operator<<(std::ostream& os, const MemoryStats& stats);
+    };
+}
+
+#endif
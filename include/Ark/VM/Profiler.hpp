@@ -0,0 +1,129 @@
+/**
+ * @file Profiler.hpp
+ * @author Alexandre Plateau (lexplt.dev@gmail.com)
+ * @brief Collect statistics about the executed bytecode, per instruction and per function
+ * @version 0.1
+ * @date 2021-02-10
+ * 
+ * @copyright Copyright (c) 2021
+ * 
+ */
+
+#ifndef ark_vm_profiler
+#define ark_vm_profiler
+
+#include <array>
+#include <vector>
+#include <chrono>
+#include <cinttypes>
+#include <iostream>
+#include <string>
+
+namespace Ark::internal
+{
+    /**
+     * @brief Statistics about a page (ie a function) of bytecode
+     * 
+     */
+    struct PageStats
+    {
+        uint64_t calls = 0;
+        uint64_t instructions = 0;
+        std::chrono::nanoseconds inclusive { 0 };  ///< time spent in the function and its callees
+        std::chrono::nanoseconds exclusive { 0 };  ///< time spent in the function only
+        uint16_t symbol_id = 0xffff;               ///< symbol used to call the function, 0xffff if unknown
+    };
+
+    /**
+     * @brief Collect execution statistics for the virtual machine
+     * 
+     * The VM only calls the profiler when running in profiling mode, thus it costs nothing otherwise.
+     */
+    class Profiler
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Construct a new Profiler object
+         * 
+         * @param pages_count number of pages of bytecode
+         */
+        explicit Profiler(std::size_t pages_count) noexcept;
+
+        /**
+         * @brief Register an executed instruction
+         * 
+         * @param inst the instruction
+         * @param page the page it belongs to
+         */
+        inline void instruction(uint8_t inst, std::size_t page) noexcept;
+
+        /**
+         * @brief Register the entry in a function
+         * 
+         * @param page the page of the function
+         * @param symbol_id the symbol used to call the function
+         * @param depth number of frames once the function has been entered
+         */
+        void enter(std::size_t page, uint16_t symbol_id, std::size_t depth) noexcept;
+
+        /**
+         * @brief Register the exit of a function
+         * @details Does nothing if the function at the given depth wasn't registered,
+         *          which happens for the calls made from C++ through VM::resolve
+         * 
+         * @param depth number of frames before leaving the function
+         */
+        void leave(std::size_t depth) noexcept;
+
+        /**
+         * @brief Leave all the functions still running, used when the VM stops
+         * 
+         */
+        void leaveAll() noexcept;
+
+        /**
+         * @brief Display a report, with the functions sorted by exclusive time and the instructions by count
+         * 
+         * @param os the output stream
+         * @param symbols the symbols table, to name the functions
+         */
+        void report(std::ostream& os, const std::vector<std::string>& symbols) const;
+
+        /**
+         * @brief Write the statistics as JSON
+         * 
+         * @param os the output stream
+         * @param symbols the symbols table, to name the functions
+         */
+        void toJSON(std::ostream& os, const std::vector<std::string>& symbols) const;
+
+    private:
+        struct Entry
+        {
+            std::size_t page;
+            std::size_t depth;
+            Clock::time_point start;
+            std::chrono::nanoseconds children;
+        };
+
+        std::array<uint64_t, 256> m_instructions;
+        std::vector<PageStats> m_pages;
+        std::vector<uint16_t> m_active;  ///< number of running calls per page, to avoid counting twice recursive calls in the inclusive time
+        std::vector<Entry> m_stack;
+
+        /**
+         * @brief Get the name of a function
+         * 
+         * @param page 
+         * @param symbols 
+         * @return std::string 
+         */
+        std::string pageName(std::size_t page, const std::vector<std::string>& symbols) const;
+    };
+
+    #include "inline/Profiler.inl"
+}
+
+#endif
@@ -0,0 +1,121 @@
+/**
+ * @file Range.hpp
+ * @author Alexandre Plateau (lexplt.dev@gmail.com)
+ * @brief Subtype of the value type, handling lazy ranges of numbers
+ * @version 0.1
+ * @date 2021-03-03
+ * 
+ * @copyright Copyright (c) 2021
+ * 
+ */
+
+#ifndef ark_vm_range
+#define ark_vm_range
+
+#include <cinttypes>
+#include <iostream>
+#include <limits>
+
+namespace Ark::internal
+{
+    /**
+     * @brief The numbers from start (included) to end (excluded) by step, computed when they are needed
+     * 
+     * A range is also an iterator, remembering the next number to give. Like a dictionary,
+     * it is shared by all the values copied from it, so that advancing one of them advances the others.
+     * The constants (bound with let) get their own copy, see VM::unshareObject.
+     */
+    class Range
+    {
+    public:
+        /**
+         * @brief Maximum number of numbers in a range, to be usable by len and @
+         * 
+         */
+        static constexpr std::size_t MaxSize = static_cast<std::size_t>(std::numeric_limits<int>::max());
+
+        /**
+         * @brief Compute the number of numbers from start to end by step
+         * 
+         * @param start 
+         * @param end 
+         * @param step must not be 0
+         * @return double 0 if end can't be reached, may be more than MaxSize
+         */
+        static double count(double start, double end, double step) noexcept;
+
+        /**
+         * @brief Construct a new Range object
+         * 
+         * @param start first number
+         * @param end the range stops before reaching it
+         * @param step must not be 0
+         * @details The range is truncated to MaxSize numbers.
+         */
+        Range(double start, double end, double step) noexcept;
+
+        /**
+         * @brief Number of numbers in the range, whatever the position of the iterator
+         * 
+         * @return std::size_t 
+         */
+        std::size_t size() const noexcept;
+
+        /**
+         * @brief Compute the number at a given position
+         * 
+         * @param index must be less than size()
+         * @return double 
+         */
+        inline double at(std::size_t index) const noexcept
+        {
+            return m_start + static_cast<double>(index) * m_step;
+        }
+
+        /**
+         * @brief Check if the iterator gave all the numbers
+         * 
+         * @return true 
+         * @return false 
+         */
+        inline bool done() const noexcept
+        {
+            return m_index >= m_size;
+        }
+
+        /**
+         * @brief Give the next number and advance the iterator
+         * 
+         * @return double must not be called when done() is true
+         */
+        inline double next() noexcept
+        {
+            return at(m_index++);
+        }
+
+        /**
+         * @brief Go back to the first number
+         * 
+         */
+        inline void reset() noexcept
+        {
+            m_index = 0;
+        }
+
+        inline double start() const noexcept { return m_start; }
+        inline double end() const noexcept { return m_end; }
+        inline double step() const noexcept { return m_step; }
+
+        friend bool operator==(const Range& A, const Range& B) noexcept;
+        friend std::ostream& operator<<(std::ostream& os, const Range& R) noexcept;
+
+    private:
+        double m_start;
+        double m_end;
+        double m_step;
+        std::size_t m_size;
+        std::size_t m_index;
+    };
+}
+
+#endif
@@ -0,0 +1,104 @@
+/**
+ * @file Sampler.hpp
+ * @author Alexandre Plateau (lexplt.dev@gmail.com)
+ * @brief Sample the ArkScript call stack at a given rate, to generate flame graphs
+ * @version 0.1
+ * @date 2021-02-12
+ * 
+ * @copyright Copyright (c) 2021
+ * 
+ */
+
+#ifndef ark_vm_sampler
+#define ark_vm_sampler
+
+#include <map>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <iostream>
+#include <condition_variable>
+
+#include <Ark/VM/Frame.hpp>
+
+namespace Ark::internal
+{
+    /**
+     * @brief Sample the call stack of a VM at a given rate
+     * 
+     * A timer thread raises a flag at each tick, and the VM records its own call stack
+     * the next time it checks the flag, between two instructions. Thus the VM state is
+     * never read from another thread, and the only cost for the interpreter loop is an
+     * atomic load per instruction.
+     */
+    class Sampler
+    {
+    public:
+        /**
+         * @brief Construct a new Sampler object
+         * 
+         * @param rate number of samples per second
+         */
+        explicit Sampler(unsigned rate) noexcept;
+
+        /**
+         * @brief Destroy the Sampler object, stopping the timer thread if needed
+         * 
+         */
+        ~Sampler();
+
+        /**
+         * @brief Start the timer thread
+         * 
+         */
+        void start();
+
+        /**
+         * @brief Stop the timer thread
+         * 
+         */
+        void stop();
+
+        /**
+         * @brief Check if a sample should be taken
+         * 
+         * @return true 
+         * @return false 
+         */
+        inline bool requested() const noexcept;
+
+        /**
+         * @brief Record the current call stack
+         * 
+         * @param frames the frames of the VM, the first one being the global scope
+         * @param ip the instruction pointer in the last frame
+         */
+        void sample(const std::vector<Frame>& frames, int ip);
+
+        /**
+         * @brief Write the samples in the collapsed stack format (one stack per line, followed by its count)
+         * 
+         * @param os the output stream
+         * @param pages_names the name of each function, indexed by page
+         */
+        void toFolded(std::ostream& os, const std::vector<std::string>& pages_names) const;
+
+    private:
+        std::chrono::microseconds m_interval;
+        std::atomic<bool> m_requested;
+        bool m_running;
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        std::thread m_thread;
+
+        // pages from the global scope to the current function, then the instruction pointer
+        std::map<std::vector<std::size_t>, uint64_t> m_stacks;
+    };
+
+    #include "inline/Sampler.inl"
+}
+
+#endif
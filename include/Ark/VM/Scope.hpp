@@ -33,6 +33,19 @@ namespace Ark::internal
          */
         Scope() noexcept;
 
+        /**
+         * @brief Reserve memory for a given number of variables
+         * 
+         * @param size 
+         */
+        void reserve(std::size_t size) noexcept;
+
+        /**
+         * @brief Remove all the variables, keeping the memory reserved for them
+         * 
+         */
+        void clear() noexcept;
+
         /**
          * @brief Put a value in the scope
          * 
@@ -66,6 +79,18 @@ namespace Ark::internal
          */
         Value* operator[](uint16_t id) noexcept;
 
+        /**
+         * @brief Get a value from its symbol id, trying first the slot found by a previous lookup
+         * 
+         * Used as an inline cache by the VM: when closures are created by the same function,
+         * their scopes share the same layout and the slot is valid for all of them.
+         * 
+         * @param id 
+         * @param slot index of the value in the scope found by the last lookup, updated on a miss
+         * @return Value* Returns nullptr if the value can not be found
+         */
+        Value* lookupCached(uint16_t id, uint16_t& slot) noexcept;
+
         /**
          * @brief Get the id of a variable based on its value ; used for debug only
          * 
@@ -82,6 +107,7 @@ namespace Ark::internal
         const std::size_t size() const noexcept;
 
         friend class Ark::VM;
+        friend class GarbageCollector;
 
     private:
         std::vector<std::pair<uint16_t, Value>> m_data;
@@ -16,6 +16,7 @@
 #include <vector>
 #include <cinttypes>
 #include <unordered_map>
+#include <memory>
 
 #include <Ark/VM/Value.hpp>
 #include <Ark/Compiler/BytecodeReader.hpp>
@@ -24,9 +25,27 @@
 
 namespace Ark
 {
+    namespace internal
+    {
+        /**
+         * @brief Facts about a code page, computed once when the bytecode is loaded
+         * 
+         */
+        struct PageMetadata
+        {
+            uint16_t arity = 0;         ///< number of arguments, ie leading MUT instructions of the page
+            uint16_t locals_count = 0;  ///< number of LET/MUT instructions in the page
+            uint16_t name_id = 0xffff;  ///< symbol the function is bound to by let/mut/set, 0xffff if none was found
+        };
+    }
+
     /**
      * @brief Ark state to handle the dirty job of loading and compiling ArkScript code
      * 
+     * Once the code is loaded (feed, doFile, doString) and the functions are registered,
+     * the VMs only read the state: it can be shared by many VMs running on different threads,
+     * without copying the bytecode. Modifying it (loading code, loadFunction, setArgs, reset...)
+     * while a VM is using it is not thread safe.
      */
     class State
     {
@@ -75,6 +94,19 @@ namespace Ark
          */
         bool doString(const std::string& code);
 
+        /**
+         * @brief Compile a string against the symbols and constants already loaded, and append the new code pages
+         * 
+         * Only the given code is compiled, the tables and pages loaded before are kept so that
+         * the new code can refer to them. The entry point of the new code is the first page
+         * appended, ie the number of pages before the call. Used by the REPL, run it with VM::runIncremental.
+         * 
+         * @param code the ArkScript code
+         * @return true on success
+         * @return false on failure
+         */
+        bool doStringIncremental(const std::string& code);
+
         /**
          * @brief Register a function in the virtual machine
          * 
@@ -83,6 +115,14 @@ namespace Ark
          */
         void loadFunction(const std::string& name, internal::Value::ProcType function) noexcept;
 
+        /**
+         * @brief Register a function in the virtual machine, reading its arguments directly from the VM stack
+         * 
+         * @param name the name of the function in ArkScript
+         * @param function the code of the function
+         */
+        void loadFunction(const std::string& name, internal::Value::FastProcType function) noexcept;
+
         /**
          * @brief Set the script arguments in sys:args
          * 
@@ -133,6 +173,12 @@ namespace Ark
          */
         bool compile(unsigned debug, const std::string& file, const std::string& output, const std::string& lib_dir, uint16_t options);
 
+        /**
+         * @brief Compute the metadata of the pages which don't have any yet
+         * 
+         */
+        void computePagesMetadata() noexcept;
+
         inline void throwStateError(const std::string& message)
         {
             throw std::runtime_error("StateError: " + message);
@@ -147,11 +193,17 @@ namespace Ark
 
         // related to the bytecode
         std::vector<std::string> m_symbols;
+        std::unordered_map<std::string, uint16_t> m_symbols_ids;  ///< symbol name to id, to avoid searching m_symbols
         std::vector<internal::Value> m_constants;
         std::vector<bytecode_t> m_pages;
+        std::vector<internal::PageMetadata> m_pages_metadata;
 
         // related to the execution
         std::unordered_map<std::string, internal::Value> m_binded;
+
+        // kept alive between calls to doStringIncremental
+        std::unique_ptr<Compiler> m_incremental_compiler;
+        std::size_t m_incremental_page = 0;  ///< first page added by the last call to doStringIncremental
     };
 }
 
@@ -0,0 +1,66 @@
+/**
+ * @file Task.hpp
+ * @author Alexandre Plateau (lexplt.dev@gmail.com)
+ * @brief The tasks run by the VM, which can be suspended while waiting for a timer or an I/O operation
+ * @version 0.1
+ * @date 2021-02-19
+ * 
+ * @copyright Copyright (c) 2021
+ * 
+ */
+
+#ifndef ark_vm_task
+#define ark_vm_task
+
+#include <vector>
+#include <optional>
+#include <cinttypes>
+
+#include <Ark/VM/Value.hpp>
+#include <Ark/VM/Scope.hpp>
+#include <Ark/VM/Frame.hpp>
+
+namespace Ark::internal
+{
+    /**
+     * @brief Everything needed to continue an execution where it stopped
+     * 
+     */
+    struct ExecutionContext
+    {
+        std::vector<Frame> frames;
+        std::vector<Scope_t> locals;
+        std::optional<Scope_t> saved_scope;
+        int ip = 0;
+        std::size_t pp = 0;
+        uint16_t last_sym_loaded = 0;
+    };
+
+    /**
+     * @brief An execution of ArkScript code, the main program or a function started by async:spawn
+     * 
+     */
+    struct Task
+    {
+        enum class Status
+        {
+            Ready,      ///< waiting to be run by the VM
+            Running,
+            Suspended,  ///< waiting for a timer, an I/O operation or another task
+            Finished
+        };
+
+        Status status = Status::Ready;
+        ExecutionContext context;  ///< empty until the task is started, and after it finished
+        std::size_t base_frame_count = 0;  ///< the number of frames when the task is done
+
+        // the function to call to start the task
+        Value function;
+        std::vector<Value> args;
+
+        Value result;  ///< given back to the task when it is resumed, and its return value once finished
+        std::vector<std::size_t> awaiting;  ///< the tasks waiting for this one to finish
+    };
+}
+
+#endif
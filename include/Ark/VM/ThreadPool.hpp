@@ -0,0 +1,103 @@
+/**
+ * @file ThreadPool.hpp
+ * @author Alexandre Plateau (lexplt.dev@gmail.com)
+ * @brief A pool of threads to run the parallel builtins
+ * @version 0.1
+ * @date 2021-02-18
+ * 
+ * @copyright Copyright (c) 2021
+ * 
+ */
+
+#ifndef ark_vm_threadpool
+#define ark_vm_threadpool
+
+#include <deque>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+
+namespace Ark::internal
+{
+    /**
+     * @brief Run indexed tasks on a fixed set of threads
+     * 
+     * The thread asking for the tasks runs some of them as well, and takes the remaining ones
+     * if all the workers are busy: a task can use the pool again without blocking it.
+     */
+    class ThreadPool
+    {
+    public:
+        /**
+         * @brief Construct a new Thread Pool object
+         * 
+         * @param workers number of threads to create, besides the ones using the pool
+         */
+        explicit ThreadPool(std::size_t workers);
+
+        /**
+         * @brief Destroy the Thread Pool object, waiting for the workers to finish their current task
+         * 
+         */
+        ~ThreadPool();
+
+        /**
+         * @brief Run task(0) to task(count - 1) and wait for them to finish
+         * 
+         * If some tasks throw, the first exception caught is thrown again once all the tasks are finished.
+         * 
+         * @param count number of tasks
+         * @param task 
+         */
+        void run(std::size_t count, const std::function<void(std::size_t)>& task);
+
+        /**
+         * @brief Get the number of threads which can run tasks at the same time, including the caller
+         * 
+         * @return std::size_t 
+         */
+        std::size_t concurrency() const noexcept;
+
+        /**
+         * @brief Get the pool shared by the whole program, with a worker per hardware thread besides the caller
+         * 
+         * @return ThreadPool& 
+         */
+        static ThreadPool& global();
+
+    private:
+        struct Job
+        {
+            const std::function<void(std::size_t)>& task;
+            std::size_t count;
+            std::atomic<std::size_t> next { 0 };
+            std::atomic<std::size_t> done { 0 };
+            std::exception_ptr error;
+            std::mutex mutex;  ///< protects error, and used to wait for the job to be done
+            std::condition_variable finished;
+
+            Job(const std::function<void(std::size_t)>& task_, std::size_t count_) :
+                task(task_), count(count_)
+            {}
+
+            /**
+             * @brief Run the tasks of the job until none are left
+             * 
+             */
+            void work();
+        };
+
+        std::vector<std::thread> m_workers;
+        std::deque<std::shared_ptr<Job>> m_jobs;
+        std::mutex m_mutex;
+        std::condition_variable m_wake_up;
+        bool m_stop;
+    };
+}
+
+#endif
@@ -31,12 +31,15 @@ namespace Ark
     public:
         /**
          * @brief A structure holding a bunch of pointers to different useful functions related to this usertype
+         * @details The deleter and the copier must not throw: they are called from noexcept functions,
+         *          and may run on any thread holding a copy of the usertype.
          * 
          */
         struct ControlFuncs
         {
             std::ostream& (*ostream_func) (std::ostream&, const UserType&) = nullptr;
-            void          (*deleter) (void*)                               = nullptr;
+            void          (*deleter) (void*)                               = nullptr;  ///< called by every copy of the usertype when it is destroyed
+            void          (*copier) (void*)                                = nullptr;  ///< called when the usertype is copied, to count the references held by the copies
         };
 
         /**
@@ -52,6 +55,35 @@ namespace Ark
             m_type_id(typeid(T).hash_code() & static_cast<uint16_t>(~0))
         {}
 
+        /**
+         * @brief Copy a User Type object, calling the copier on the data if there is one
+         * @details The values are copied a lot by the VM: a usertype owning its data must count
+         *          the references through the copier, and free it when the deleter was called
+         *          as many times
+         * 
+         * @param other 
+         */
+        UserType(const UserType& other) noexcept :
+            m_type_id(other.m_type_id),
+            m_data(other.m_data),
+            m_funcs(other.m_funcs)
+        {
+            if (m_funcs != nullptr && m_funcs->copier != nullptr)
+                m_funcs->copier(m_data);
+        }
+
+        UserType& operator=(const UserType& other) noexcept
+        {
+            if (other.m_funcs != nullptr && other.m_funcs->copier != nullptr)
+                other.m_funcs->copier(other.m_data);
+            release();
+
+            m_type_id = other.m_type_id;
+            m_data = other.m_data;
+            m_funcs = other.m_funcs;
+            return *this;
+        }
+
         /**
          * @brief Destroy the User Type object
          * @details Called by the VM when `(del obj)` is found or when the object goes
@@ -59,9 +91,7 @@ namespace Ark
          */
         ~UserType() noexcept
         {
-            // call a custom deleter on the data held by the usertype
-            if (m_funcs != nullptr && m_funcs->deleter != nullptr)
-               m_funcs->deleter(m_data);
+            release();
         }
 
         /**
@@ -123,6 +153,13 @@ namespace Ark
         friend inline std::ostream& operator<<(std::ostream& os, const UserType& A) noexcept;
 
     private:
+        // call a custom deleter on the data held by the usertype
+        void release() noexcept
+        {
+            if (m_funcs != nullptr && m_funcs->deleter != nullptr)
+               m_funcs->deleter(m_data);
+        }
+
         uint16_t m_type_id;
         void* m_data;
         ControlFuncs* m_funcs;
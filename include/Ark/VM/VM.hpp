@@ -13,14 +13,18 @@
 #define ark_vm
 
 #include <vector>
+#include <array>
 #include <string>
 #include <cinttypes>
 #include <algorithm>
 #include <optional>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
+#include <deque>
 #include <utility>
 #include <mutex>
+#include <sstream>
 
 #include <Ark/VM/Value.hpp>
 #include <Ark/VM/Scope.hpp>
@@ -30,6 +34,12 @@
 #include <Ark/Log.hpp>
 #include <Ark/Config.hpp>
 #include <Ark/VM/Plugin.hpp>
+#include <Ark/VM/Profiler.hpp>
+#include <Ark/VM/Sampler.hpp>
+#include <Ark/VM/MemoryStats.hpp>
+#include <Ark/VM/GarbageCollector.hpp>
+#include <Ark/VM/Task.hpp>
+#include <Ark/VM/EventLoop.hpp>
 
 #undef abs
 #include <cmath>
@@ -38,6 +48,36 @@ namespace Ark
 {
     using namespace std::string_literals;
 
+    class VM;
+
+    /**
+     * @brief A function of a VM, found once by its name to be called many times without looking it up again
+     * @details It can only be called by the VM which found it, until this VM is reset (by another run, or by a VMPool).
+     * 
+     */
+    class FunctionHandle
+    {
+    public:
+        /**
+         * @brief Get the symbol id of the function
+         * 
+         * @return uint16_t 
+         */
+        uint16_t id() const noexcept { return m_id; }
+
+        friend class VM;
+
+    private:
+        internal::Value m_function;  ///< a copy of the function (page address or closure) when it was found
+        uint16_t m_id;
+        const VM* m_vm;              ///< the VM which found the function
+        std::size_t m_generation;    ///< number of resets of the VM when the function was found
+
+        FunctionHandle(const internal::Value& function, uint16_t id, const VM* vm, std::size_t generation) :
+            m_function(function), m_id(id), m_vm(vm), m_generation(generation)
+        {}
+    };
+
     /**
      * @brief The ArkScript virtual machine, executing ArkScript bytecode
      * 
@@ -48,9 +88,15 @@ namespace Ark
         /**
          * @brief Construct a new vm t object
          * 
-         * @param state a pointer to an ArkScript state, which can be reused for multiple VMs
+         * @param state a pointer to an ArkScript state, which can be reused for multiple VMs, even on different threads
+         */
+        explicit VM(const State* state) noexcept;
+
+        /**
+         * @brief Destroy the VM, writing what is left of the buffered output
+         * 
          */
-        explicit VM(State* state) noexcept;
+        ~VM();
 
         /**
          * @brief Run the bytecode held in the state
@@ -59,6 +105,15 @@ namespace Ark
          */
         int run() noexcept;
 
+        /**
+         * @brief Run the code compiled by the last call to State::doStringIncremental, keeping the variables of the previous runs
+         * @details The symbols added since the previous run get the functions bound with State::loadFunction
+         * and the ones of the plugins already loaded. If the code fails, only the global frame and scope are kept.
+         * 
+         * @return int the exit code (default to 0 if no error)
+         */
+        int runIncremental() noexcept;
+
         /**
          * @brief Retrieve a value from the virtual machine, given its symbol name
          * 
@@ -78,6 +133,56 @@ namespace Ark
         template <typename... Args>
         internal::Value call(const std::string& name, Args&&... args);
 
+        /**
+         * @brief Create a VM running the same code, sharing the variables of this one, to call functions on another thread
+         * 
+         * The scopes of this VM are shared with the new one, without copying them: the functions called on the new VM
+         * must be pure, they can read the variables of this VM but not modify them, nor their captured variables
+         * (use isolate to give them their own copy of a value). Their own local variables are created in new scopes.
+         * The errors happening in the new VM are thrown instead of being displayed.
+         * With FeatureBufferedOutput, the new VM has its own buffer, written when it is destroyed: flush this VM before running it.
+         * 
+         * @return std::unique_ptr<VM> 
+         */
+        std::unique_ptr<VM> fork() const;
+
+        /**
+         * @brief Copy a value for this VM, so that it shares nothing with the original one
+         * @details The dictionaries, ranges and the environments of the closures are copied as well (the lists and strings
+         *          already are), to give values to a VM created by fork() running on another thread.
+         *          The copied environments are tracked by the garbage collector of this VM.
+         *          The user types are copied through their copier.
+         * 
+         * @param value 
+         * @return internal::Value 
+         */
+        internal::Value isolate(const internal::Value& value);
+
+        /**
+         * @brief Find a function from ArkScript once, to call it many times
+         * 
+         * The function is copied: if the variable is modified afterward, the handle keeps calling the old function.
+         * Unlike call(name), this method doesn't lock the VM: it must not be used while another thread runs it.
+         * 
+         * @param name the function name in the ArkScript code
+         * @return FunctionHandle 
+         */
+        FunctionHandle getFunction(const std::string& name);
+
+        /**
+         * @brief Call a function found by getFunction, by giving it arguments
+         * 
+         * Unlike the other call methods, this one doesn't lock the VM: it must not be used by multiple threads at the same time.
+         * Throws if the handle was found by another VM, or before this one was reset.
+         * 
+         * @tparam Args 
+         * @param function the handle given by getFunction
+         * @param args C++ argument list, converted to internal representation
+         * @return internal::Value 
+         */
+        template <typename... Args>
+        internal::Value call(const FunctionHandle& function, Args&&... args);
+
         // function calling from plugins
 
         /**
@@ -86,7 +191,7 @@ namespace Ark
          * @tparam Args 
          * @param val the ArkScript function object
          * @param args C++ argument list
-         * @return internal::Value 
+         * @return internal::Value the lists it holds can be views, read them with listData() and listSize(), or call unshareLists()
          */
         template <typename... Args>
         internal::Value resolve(const internal::Value* val, Args&&... args);
@@ -112,11 +217,138 @@ namespace Ark
          */
         void* getUserPointer() noexcept;
 
+        /**
+         * @brief Get the stream used by print and puts
+         * @details std::cout, or a buffer of the VM when FeatureBufferedOutput is enabled.
+         *          The buffer is written to std::cout when it grows too big, and by flush()
+         * 
+         * @return std::ostream& 
+         */
+        std::ostream& output();
+
+        /**
+         * @brief Write the buffered output to std::cout, and flush it
+         * 
+         */
+        void flush();
+
+        /**
+         * @brief Collect statistics about the execution in the next runs
+         * 
+         */
+        void enableProfiler() noexcept;
+
+        /**
+         * @brief Display the statistics collected by the profiler, sorted by cost
+         * 
+         * @param os the output stream
+         * @param json write the statistics as JSON instead of a human readable report
+         */
+        void displayProfile(std::ostream& os, bool json=false) const;
+
+        /**
+         * @brief Sample the call stack during the next runs
+         * 
+         * @param rate number of samples per second
+         */
+        void enableSampler(unsigned rate) noexcept;
+
+        /**
+         * @brief Write the sampled call stacks in the collapsed format used by flamegraph.pl
+         * 
+         * @param os the output stream
+         */
+        void writeSamples(std::ostream& os) const;
+
+        /**
+         * @brief Compute the memory used by the VM, and get the allocation counters
+         * 
+         * @return MemoryStats 
+         */
+        MemoryStats memoryStats() const;
+
+        /**
+         * @brief Free the environments of the closures which are only referenced by cycles
+         * 
+         * @return std::size_t number of environments freed
+         */
+        std::size_t collectGarbage();
+
+        /**
+         * @brief Let the garbage collector free the dictionary if it ends up only referenced by cycles
+         * @details Called by the builtins creating dictionaries, may trigger a collection.
+         * 
+         * @param dict a Dict value
+         */
+        void trackDict(const internal::Value& dict);
+
+        /**
+         * @brief Set the number of closure environments created before collecting the cycles automatically
+         * 
+         * @param threshold 0 to disable the automatic collections
+         */
+        void setGCThreshold(std::size_t threshold) noexcept;
+
+        /**
+         * @brief Get the statistics of the garbage collector
+         * 
+         * @return GCStats 
+         */
+        GCStats gcStats() const noexcept;
+
+        // tasks
+
+        /**
+         * @brief Start a function in a new task, run once the current one is suspended or finished
+         * 
+         * The function only sees the global variables and the ones it captured, not the ones of the caller.
+         * 
+         * @param function the ArkScript function object
+         * @param args the arguments given to the function
+         * @return std::size_t the id of the new task
+         */
+        std::size_t spawn(const internal::Value& function, std::vector<internal::Value> args);
+
+        /**
+         * @brief Suspend the current task once the builtin calling this method returns, its return value being replaced when the task is resumed
+         * 
+         * The VM runs the other tasks in the meantime. The code called from C++ (call, resolve) can't be suspended.
+         * 
+         * @return std::size_t the id of the suspended task, to resume it later
+         */
+        std::size_t suspend();
+
+        /**
+         * @brief Schedule a suspended task, it will get a value instead of the return value of the builtin which suspended it
+         * 
+         * Must be called from the thread running the VM, the other threads should go through eventLoop().submit.
+         * 
+         * @param task the id given by suspend
+         * @param result 
+         */
+        void resume(std::size_t task, internal::Value result);
+
+        /**
+         * @brief Get the result of a task, suspending the current one until it is finished if needed
+         * 
+         * @param task the id given by spawn
+         * @return internal::Value the result if the task is finished, nil otherwise
+         */
+        internal::Value await(std::size_t task);
+
+        /**
+         * @brief Get the loop waiting for the timers and I/O operations of the suspended tasks
+         * 
+         * @return internal::EventLoop& 
+         */
+        internal::EventLoop& eventLoop() noexcept;
+
         friend class internal::Value;
         friend class Repl;
+        friend class VMPool;
 
     private:
-        State* m_state;
+        const State* m_state;
 
         int m_exitCode;
         int m_ip;           // instruction pointer
@@ -124,13 +356,30 @@ namespace Ark
         bool m_running;
         uint16_t m_last_sym_loaded;
         std::size_t m_until_frame_count;
-        std::mutex m_mutex;
+        std::recursive_mutex m_mutex;  // recursive: the builtins can call resolve while a function called by the host runs
+
+        // declared before the frames and scopes so that it is destroyed after them,
+        // and can free the cycles they left behind
+        internal::GarbageCollector m_gc;
 
         // related to the execution
         std::vector<internal::Frame> m_frames;
         std::optional<internal::Scope_t> m_saved_scope;
         std::vector<internal::Scope_t> m_locals;
         std::vector<std::shared_ptr<internal::SharedLibrary>> m_shared_lib_objects;
+        std::size_t m_known_symbols = 0;  ///< the symbols which got their bound and plugin functions, see registerNewSymbols
+        MemoryStats m_memory;  ///< only the counters and high-water marks are updated during the execution
+
+        // inline caches for GET_FIELD: for each page, the scope slot found by the
+        // last field read, indexed by instruction address (allocated on first use)
+        std::vector<std::vector<uint16_t>> m_field_cache;
+
+        // only allocated when profiling
+        std::unique_ptr<internal::Profiler> m_profiler;
+        std::unique_ptr<internal::Sampler> m_sampler;
+
+        // output of print and puts, when FeatureBufferedOutput is enabled
+        std::ostringstream m_output;
 
         // just a nice little trick for operator[]
         internal::Value m__no_value = internal::Builtins::nil;
@@ -138,6 +387,21 @@ namespace Ark
         // needed to pass data around when binding ArkScript in a program
         void* m_user_pointer;
 
+        // created by fork(): the errors are thrown to the caller instead of being displayed
+        bool m_forked = false;
+
+        std::size_t m_generation = 0;  ///< incremented by reset, to refuse the function handles found before
+
+        // tasks started by async:spawn, or suspended by a builtin
+        std::unordered_map<std::size_t, internal::Task> m_tasks;
+        std::deque<std::size_t> m_ready_tasks;
+        std::size_t m_current_task = 0;
+        std::size_t m_next_task_id = 0;
+        bool m_suspended = false;    ///< the current task asked to be suspended
+        bool m_can_suspend = false;  ///< false outside of run, and in the functions called from C++
+        bool m_exited = false;       ///< exit was called, the remaining tasks are dropped
+        internal::EventLoop m_event_loop;
+
         /**
          * @brief Run ArkScript bytecode inside a try catch to retrieve all the exceptions and display a stack trace if needed
          * 
@@ -146,11 +410,66 @@ namespace Ark
          */
         int safeRun(std::size_t untilFrameCount=0);
 
+        /**
+         * @brief Implementation of safeRun, the profiling and sampling code is compiled only in the profiling version
+         * 
+         * @tparam Profiling 
+         * @param untilFrameCount the frame count we need to reach before stopping the VM
+         * @return int the exit code
+         */
+        template <bool Profiling>
+        int safeRunImpl(std::size_t untilFrameCount);
+
+        /**
+         * @brief Run the main program as the first task, then the other tasks until they are all finished or waiting forever
+         * 
+         * @return int the exit code of the last run, 1 if a task failed
+         */
+        int runTasks();
+
+        /**
+         * @brief Start or resume a task, making its execution context the current one
+         * 
+         * @param task 
+         * @return int the exit code
+         */
+        int runTask(std::size_t task);
+
+        /**
+         * @brief Save the execution context of the VM, leaving it empty
+         * 
+         * @param context 
+         */
+        void saveContext(internal::ExecutionContext& context) noexcept;
+
+        /**
+         * @brief Replace the execution context of the VM
+         * 
+         * @param context 
+         */
+        void loadContext(internal::ExecutionContext&& context) noexcept;
+
         /**
          * @brief Initialize the VM according to the parameters
+         * @details Can throw std::bad_alloc, when creating the global frame and scope.
+         * 
+         */
+        void init();
+
+        /**
+         * @brief Give a dictionary or a range bound to a variable its own object, so that the other variables sharing it don't see its changes
+         * @details A dictionary gets a new Dict sharing the entries until one of them is modified, a range is copied.
+         *          Done when a constant is bound to a shared object, or a variable to an object bound to a constant.
          * 
+         * @param value the value being bound, other types are left untouched
          */
-        void init() noexcept;
+        void unshareObject(internal::Value& value);
+
+        /**
+         * @brief Destroy the frames and scopes of the previous run, keeping the global ones, their memory and the plugins loaded
+         * 
+         */
+        void reset();
 
         // locals related
 
@@ -162,6 +481,15 @@ namespace Ark
          */
         inline internal::Value* findNearestVariable(uint16_t id) noexcept;
 
+        /**
+         * @brief Find the nearest variable of a given id, checking that it is a mutable list
+         * 
+         * @param id the id to find
+         * @param name name of the instruction, for the error messages
+         * @return internal::Value* never nullptr
+         */
+        inline internal::Value* findListToModify(uint16_t id, const char* name);
+
         /**
          * @brief Destroy the current frame and get back to the previous one, resuming execution
          * 
@@ -178,6 +506,49 @@ namespace Ark
          */
         void loadPlugin(uint16_t id);
 
+        /**
+         * @brief Put the functions of a plugin in the global scope, for the symbols used by the code
+         * 
+         * @param lib 
+         * @param first_id the functions whose symbol id is lower were already registered
+         */
+        void registerPluginFunctions(internal::SharedLibrary& lib, std::size_t first_id);
+
+        /**
+         * @brief Put the functions bound with State::loadFunction and the ones of the plugins already loaded in the global scope,
+         * for the symbols added to the state since the previous run
+         * 
+         * @param first_id id of the first new symbol
+         */
+        void registerNewSymbols(std::size_t first_id);
+
+        /**
+         * @brief Add the memory used by a value to the memory statistics
+         * 
+         * @param value 
+         * @param stats 
+         * @param visited the scopes and dictionaries already counted
+         */
+        void accountValue(const internal::Value& value, MemoryStats& stats, std::unordered_set<const void*>& visited) const;
+
+        /**
+         * @brief Add the memory used by a scope and its variables to the memory statistics, if it wasn't already counted
+         * 
+         * @param scope 
+         * @param stats 
+         * @param visited the scopes and dictionaries already counted
+         */
+        void accountScope(const internal::Scope* scope, MemoryStats& stats, std::unordered_set<const void*>& visited) const;
+
+        /**
+         * @brief Copy a value and everything it shares, used by isolate
+         * 
+         * @param value 
+         * @param scopes the environments already copied, so that the closures sharing one keep sharing its copy
+         * @return internal::Value 
+         */
+        internal::Value isolateValue(const internal::Value& value, std::unordered_map<const internal::Scope*, internal::Scope_t>& scopes);
+
         // error handling
 
         /**
@@ -203,6 +574,12 @@ namespace Ark
          */
         void backtrace() noexcept;
 
+        /**
+         * @brief Count the frame and scope created by a function call, and update the high-water marks
+         * 
+         */
+        inline void updateMemoryCounters() noexcept;
+
         /**
          * @brief Function called when the CALL instruction is met in the bytecode
          * 
@@ -0,0 +1,87 @@
+/**
+ * @file VMPool.hpp
+ * @author Alexandre Plateau (lexplt.dev@gmail.com)
+ * @brief Reuse virtual machines bound to the same state, to run many short scripts
+ * @version 0.1
+ * @date 2021-02-17
+ * 
+ * @copyright Copyright (c) 2021
+ * 
+ */
+
+#ifndef ark_vm_vmpool
+#define ark_vm_vmpool
+
+#include <vector>
+#include <memory>
+#include <mutex>
+
+#include <Ark/VM/VM.hpp>
+#include <Ark/VM/State.hpp>
+
+namespace Ark
+{
+    /**
+     * @brief A pool of virtual machines sharing the same state
+     * 
+     * Creating a VM for each request costs more than running a small script: the frames, stacks
+     * and scopes are allocated again each time. The pool gives VMs which already ran, their
+     * global frame and scope are emptied when they are given back, keeping the memory reserved and the plugins loaded.
+     * The pool can be used from multiple threads, as long as the state isn't modified.
+     */
+    class ARK_API_EXPORT VMPool
+    {
+    public:
+        /**
+         * @brief Give back a VM to its pool when its lease is destroyed
+         * 
+         */
+        struct Releaser
+        {
+            VMPool* pool;
+
+            void operator()(VM* vm) const noexcept;
+        };
+
+        using Lease = std::unique_ptr<VM, Releaser>;
+
+        /**
+         * @brief Construct a new VMPool object
+         * 
+         * @param state the state used by all the VMs, it must outlive the pool and the leases
+         * @param preallocated number of VMs created immediately
+         */
+        explicit VMPool(const State& state, std::size_t preallocated=0);
+
+        VMPool(const VMPool&) = delete;
+        VMPool& operator=(const VMPool&) = delete;
+
+        /**
+         * @brief Get a VM from the pool, creating one if none are available
+         * 
+         * @return Lease a pointer to the VM, giving it back to the pool when destroyed
+         */
+        Lease acquire();
+
+        /**
+         * @brief Get the number of VMs available in the pool
+         * 
+         * @return std::size_t 
+         */
+        std::size_t available() const;
+
+    private:
+        const State& m_state;
+        mutable std::mutex m_mutex;
+        std::vector<std::unique_ptr<VM>> m_available;
+
+        /**
+         * @brief Clean a VM and put it back in the pool
+         * 
+         * @param vm 
+         */
+        void release(VM* vm) noexcept;
+    };
+}
+
+#endif
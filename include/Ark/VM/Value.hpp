@@ -23,6 +23,8 @@
 #include <Ark/String.hpp>  // our string implementation
 #include <string.h>  // strcmp
 #include <array>
+#include <algorithm>
+#include <cassert>
 
 #include <Ark/VM/Types.hpp>
 #include <Ark/VM/Closure.hpp>
@@ -33,10 +35,13 @@
 namespace Ark
 {
     class VM;
+    class State;
 }
 
 namespace Ark::internal
 {
+    class GarbageCollector;
+
     // Note from the creator: we can have at most 0b01111111 (127) different types
     // because type index is stored on the 7 right most bits of a uint8_t in the class Value.
     // Order is also important because we are doing some optimizations to check ranges
@@ -50,38 +55,125 @@ namespace Ark::internal
         CProc     = 4,
         Closure   = 5,
         User      = 6,
-
-        Nil       = 7,
-        True      = 8,
-        False     = 9,
-        Undefined = 10
+        Dict      = 7,
+        Array     = 8,
+        Range     = 9,
+
+        Nil       = 10,
+        True      = 11,
+        False     = 12,
+        Undefined = 13
     };
 
-    const std::array<std::string, 11> types_to_str = {
+    const std::array<std::string, 14> types_to_str = {
         "List", "Number", "String", "Function",
-        "CProc", "Closure", "UserType",
-        "Nil", "Bool", "Bool", "Undefined"
+        "CProc", "Closure", "UserType", "Dict", "Array",
+        "Range", "Nil", "Bool", "Bool", "Undefined"
     };
 
     class Frame;
+    class ArgsView;
+    class Dict;
+    class Range;
+    class Value;
+
+    /**
+     * @brief A view over a part of a list, shared with the list it was taken from
+     * @details Created by tailOf and headOf, so that they don't have to copy the elements, and when a list is loaded
+     *          from a variable, which then holds a view over the whole buffer.
+     *          The elements of the buffer are never modified through a slice: writing to it gives it its own vector first.
+     *          The last slice using the buffer takes it back as its vector, erasing the elements it doesn't view.
+     */
+    struct ListSlice
+    {
+        std::shared_ptr<std::vector<Value>> buffer;  ///< only modified by the last slice using it, when it gets its own vector
+        uint32_t offset;
+        uint32_t size;
+    };
+
+    /**
+     * @brief Compare the elements of two slices
+     * 
+     * @param A 
+     * @param B 
+     * @return true 
+     * @return false 
+     */
+    inline bool operator==(const ListSlice& A, const ListSlice& B) noexcept;
+
+    /**
+     * @brief Compare the elements of two slices, in lexicographical order
+     * 
+     * @param A 
+     * @param B 
+     * @return true 
+     * @return false 
+     */
+    inline bool operator<(const ListSlice& A, const ListSlice& B) noexcept;
+
+    /**
+     * @brief Compare the keys and values of two dictionaries
+     * 
+     * @param A 
+     * @param B 
+     * @return true 
+     * @return false 
+     */
+    ARK_API_EXPORT bool operator==(const Dict& A, const Dict& B) noexcept;
+
+    /**
+     * @brief Check if a dictionary has no key
+     * 
+     * @param D 
+     * @return true 
+     * @return false 
+     */
+    ARK_API_EXPORT bool isEmpty(const Dict& D) noexcept;
+
+    /**
+     * @brief Compare the start, end and step of two ranges
+     * 
+     * @param A 
+     * @param B 
+     * @return true 
+     * @return false 
+     */
+    ARK_API_EXPORT bool operator==(const Range& A, const Range& B) noexcept;
+
+    /**
+     * @brief Check if a range has no number
+     * 
+     * @param R 
+     * @return true 
+     * @return false 
+     */
+    ARK_API_EXPORT bool isEmpty(const Range& R) noexcept;
 
     class ARK_API_EXPORT Value
     {
     public:
         using ProcType = Value (*) (std::vector<Value>&, Ark::VM*);  // std::function<Value (std::vector<Value>&, Ark::VM*)>;
+        // the arguments are read in place, on the stack of the VM: a builtin calling back into the same VM (resolve, call)
+        // can reallocate it, and must copy the arguments it needs out of the view before
+        using FastProcType = Value (*) (ArgsView, Ark::VM*);
         using Iterator = std::vector<Value>::iterator;
         using ConstIterator = std::vector<Value>::const_iterator;
 
         using Value_t  = std::variant<
-            double,             //  8 bytes
-            String,             // 16 bytes
-            PageAddr_t,         //  2 bytes
-            ProcType,           //  8 bytes
-            Closure,            // 24 bytes
-            UserType,           // 24 bytes
-            std::vector<Value>  // 24 bytes
-        >;                      // +8 bytes overhead
-        //                   total 32 bytes
+            double,                                //  8 bytes
+            String,                                // 16 bytes
+            PageAddr_t,                            //  2 bytes
+            ProcType,                              //  8 bytes
+            FastProcType,                          //  8 bytes
+            Closure,                               // 24 bytes
+            UserType,                              // 24 bytes
+            std::vector<Value>,                    // 24 bytes
+            std::shared_ptr<Dict>,                 // 16 bytes
+            std::shared_ptr<std::vector<double>>,  // 16 bytes
+            std::shared_ptr<Range>,                // 16 bytes
+            ListSlice                              // 24 bytes
+        >;                                         // +8 bytes overhead
+        //                                      total 32 bytes
 
         /**
          * @brief Construct a new Value object
@@ -152,6 +244,13 @@ namespace Ark::internal
          */
         explicit Value(Value::ProcType value) noexcept;
 
+        /**
+         * @brief Construct a new Value object from a C++ function reading its arguments in place, on the VM stack
+         * 
+         * @param value 
+         */
+        explicit Value(Value::FastProcType value) noexcept;
+
         /**
          * @brief Construct a new Value object as a List
          * 
@@ -173,6 +272,27 @@ namespace Ark::internal
          */
         explicit Value(UserType&& value) noexcept;
 
+        /**
+         * @brief Construct a new Value object as a Dict, sharing an existing dictionary
+         * 
+         * @param value 
+         */
+        explicit Value(std::shared_ptr<Dict> value) noexcept;
+
+        /**
+         * @brief Construct a new Value object as an Array of numbers, shared by the copies of the value until one of them is modified
+         * 
+         * @param value 
+         */
+        explicit Value(std::vector<double>&& value);
+
+        /**
+         * @brief Construct a new Value object as a Range, sharing an existing range
+         * 
+         * @param value 
+         */
+        explicit Value(std::shared_ptr<Range> value) noexcept;
+
         /**
          * @brief Return the value type
          * 
@@ -180,6 +300,14 @@ namespace Ark::internal
          */
         inline ValueType valueType() const noexcept;
 
+        /**
+         * @brief Check if the value is const or not, ie loaded from a constant (bound with let)
+         * 
+         * @return true 
+         * @return false 
+         */
+        inline const bool isConst() const noexcept;
+
         /**
          * @brief Check if a function is held
          * 
@@ -204,11 +332,28 @@ namespace Ark::internal
 
         /**
          * @brief Return the stored list
+         * @details The lists created by tailOf and headOf are views (see ListSlice), only a view over a whole list can be read
+         *          as a vector. The values given to the plugins, and returned by VM::call and VM::operator[], hold vectors
+         *          (see unshareLists). listSize() and listData() read any list without copying it.
          * 
          * @return const std::vector<Value>& 
          */
         inline const std::vector<Value>& const_list() const;
 
+        /**
+         * @brief Return the number of elements of the stored list, without copying a slice
+         * 
+         * @return std::size_t 
+         */
+        inline std::size_t listSize() const;
+
+        /**
+         * @brief Return a pointer to the first element of the stored list, without copying a slice
+         * 
+         * @return const Value* 
+         */
+        inline const Value* listData() const;
+
         /**
          * @brief Return the stored user type
          * 
@@ -217,7 +362,28 @@ namespace Ark::internal
         inline const UserType& usertype() const;
 
         /**
-         * @brief Return the stored list as a reference
+         * @brief Return the stored dictionary
+         * 
+         * @return const Dict& 
+         */
+        inline const Dict& const_dict() const;
+
+        /**
+         * @brief Return the stored array of numbers
+         * 
+         * @return const std::vector<double>& 
+         */
+        inline const std::vector<double>& const_array() const;
+
+        /**
+         * @brief Return the stored range
+         * 
+         * @return const Range& 
+         */
+        inline const Range& const_range() const;
+
+        /**
+         * @brief Return the stored list as a reference, copying the elements of a view first
          * 
          * @return std::vector<Value>& 
          */
@@ -237,6 +403,44 @@ namespace Ark::internal
          */
         UserType& usertype_ref();
 
+        /**
+         * @brief Return the stored dictionary as a reference, shared with the copies of this value
+         * 
+         * @return Dict& 
+         */
+        Dict& dict();
+
+        /**
+         * @brief Return the stored array of numbers as a reference, copying the numbers first if they are shared with another value
+         * 
+         * @return std::vector<double>& 
+         */
+        std::vector<double>& array();
+
+        /**
+         * @brief Return the stored range as a reference, to iterate on it
+         * 
+         * @return Range& 
+         */
+        Range& range();
+
+        /**
+         * @brief Return a List sharing the elements [offset, offset + size[ of the stored list
+         * @details The elements of a plain list are moved to a shared buffer, this value becomes a view over all of them
+         * 
+         * @param offset 
+         * @param size 
+         * @return Value 
+         */
+        Value sliceList(std::size_t offset, std::size_t size);
+
+        /**
+         * @brief Give the stored list, and the lists it holds, their own vector when they are views over a part of a list
+         * @details Only the views are copied, afterward const_list() can read all of them.
+         * 
+         */
+        void unshareLists();
+
         /**
          * @brief Add an element to the list held by the value (if the value type is set to list)
          * 
@@ -257,13 +461,57 @@ namespace Ark::internal
         friend inline bool operator!(const Value& A) noexcept;
 
         friend class Ark::VM;
+        friend class Ark::State;
+        friend class Ark::internal::GarbageCollector;
 
     private:
         Value_t m_value;
         uint8_t m_constType;  ///< First bit if for constness, right most bits are for type
 
+        /**
+         * @brief Construct a new Value object as a List viewing a part of another one
+         * 
+         * @param value 
+         */
+        explicit Value(ListSlice&& value) noexcept;
+
+        /**
+         * @brief Move the elements of a plain list to a shared buffer, this value becoming a view over all of them
+         * @details Done by the VM when loading a list, so that the loaded copies share the elements instead of copying them.
+         * 
+         */
+        void shareList();
+
+        /**
+         * @brief Replace a slice by a vector holding its elements, taking the buffer back if nothing else shares it
+         * 
+         */
+        void unshareList();
+
+        /**
+         * @brief Check if the stored list, or one of the lists it holds, is a view over a part of a list
+         * 
+         * @return true if const_list() can't read all of them
+         */
+        bool holdsPartialView() const noexcept;
+
         // private getters only for the virtual machine
 
+        /**
+         * @brief Return a reference to the number held by the value, without checking its type
+         * @details Used by the numeric fast paths of the VM, after checking that the value is a Number
+         * 
+         * @return double& 
+         */
+        inline double& number_ref() noexcept;
+
+        /**
+         * @brief Replace a Number by True or False, in place
+         * 
+         * @param value 
+         */
+        inline void setBool(bool value) noexcept;
+
         /**
          * @brief Return the page address held by the value
          * 
@@ -293,19 +541,107 @@ namespace Ark::internal
         internal::Closure& closure_ref();
 
         /**
-         * @brief Check if the value is const or not
+         * @brief Set the Const object
+         * 
+         * @param value 
+         */
+        inline void setConst(bool value) noexcept;
+    };
+
+    /**
+     * @brief A non owning view over the arguments given to a builtin
+     * 
+     * The arguments live on the stack of the calling frame, thus the view is only valid
+     * during the call, and as long as the function doesn't call back into the VM.
+     * The debug builds check that the stack wasn't reallocated each time the view is read.
+     */
+    class ArgsView
+    {
+    public:
+        using Iterator = Value*;
+
+        /**
+         * @brief Construct a new ArgsView object
+         * 
+         * @param data pointer to the first argument
+         * @param size number of arguments
+         */
+        ArgsView(Value* data, std::size_t size) noexcept :
+            m_data(data), m_size(size), m_frames(nullptr), m_frame(0), m_stack_data(nullptr)
+        {}
+
+        /**
+         * @brief Construct a new ArgsView object over the top of the stack of a frame
+         * 
+         * @param data pointer to the first argument
+         * @param size number of arguments
+         * @param frames the frames of the VM
+         * @param frame index of the frame holding the arguments
+         * @param stack_data the memory of its stack
+         */
+        ArgsView(Value* data, std::size_t size, const std::vector<Frame>* frames, std::size_t frame, const Value* stack_data) noexcept :
+            m_data(data), m_size(size), m_frames(frames), m_frame(frame), m_stack_data(stack_data)
+        {}
+
+        /**
+         * @brief Get an argument
+         * 
+         * @param index 
+         * @return Value& 
+         */
+        inline Value& operator[](std::size_t index) noexcept;
+
+        /**
+         * @brief Get an argument
+         * 
+         * @param index 
+         * @return const Value& 
+         */
+        inline const Value& operator[](std::size_t index) const noexcept;
+
+        /**
+         * @brief Return the number of arguments
+         * 
+         * @return std::size_t 
+         */
+        inline std::size_t size() const noexcept;
+
+        /**
+         * @brief Check if no argument was given
          * 
          * @return true 
          * @return false 
          */
-        inline const bool isConst() const noexcept;
+        inline bool empty() const noexcept;
 
         /**
-         * @brief Set the Const object
+         * @brief Return an iterator to the first argument
          * 
-         * @param value 
+         * @return Iterator 
          */
-        inline void setConst(bool value) noexcept;
+        inline Iterator begin() noexcept;
+
+        /**
+         * @brief Return an iterator past the last argument
+         * 
+         * @return Iterator 
+         */
+        inline Iterator end() noexcept;
+
+    private:
+        Value* m_data;
+        std::size_t m_size;
+        const std::vector<Frame>* m_frames;  ///< nullptr if the arguments aren't on the stack of a frame
+        std::size_t m_frame;
+        const Value* m_stack_data;           ///< the memory of the stack when the view was created
+
+        /**
+         * @brief Check that the stack holding the arguments wasn't reallocated since the view was created, used by the debug builds
+         * 
+         * @return true 
+         * @return false 
+         */
+        bool valid() const noexcept;
     };
 
     #include "inline/Value.inl"
@@ -24,6 +24,21 @@ inline void Frame::push(Value&& value) noexcept
         m_stack.emplace_back(ValueType::Undefined);
 }
 
+inline Value* Frame::peek() noexcept
+{
+    return &m_stack[m_i - 1];
+}
+
+inline ArgsView Frame::top(uint16_t count) noexcept
+{
+    return ArgsView(&m_stack[m_i - count], count);
+}
+
+inline void Frame::drop(uint16_t count) noexcept
+{
+    m_i -= count;
+}
+
 // getters-setters (misc)
 
 inline std::size_t Frame::stackSize() const noexcept
@@ -0,0 +1,16 @@
+inline void GarbageCollector::track(const Scope_t& scope)
+{
+    // the same environment can be shared by multiple closures
+    if (m_tracked.empty() || m_tracked.back().lock() != scope)
+        m_tracked.emplace_back(scope);
+}
+
+inline void GarbageCollector::track(const std::shared_ptr<Dict>& dict)
+{
+    m_tracked_dicts.emplace_back(dict);
+}
+
+inline bool GarbageCollector::shouldCollect() const noexcept
+{
+    return m_threshold != 0 && m_tracked.size() + m_tracked_dicts.size() >= m_next_collection;
+}
@@ -0,0 +1,5 @@
+inline void Profiler::instruction(uint8_t inst, std::size_t page) noexcept
+{
+    m_instructions[inst]++;
+    m_pages[page].instructions++;
+}
@@ -0,0 +1,4 @@
+inline bool Sampler::requested() const noexcept
+{
+    return m_requested.load(std::memory_order_relaxed);
+}
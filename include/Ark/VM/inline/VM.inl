@@ -6,38 +6,35 @@
 
 template <typename... Args>
 internal::Value VM::call(const std::string& name, Args&&... args)
+{
+    const std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+    return call(getFunction(name), std::forward<Args>(args)...);
+}
+
+template <typename... Args>
+internal::Value VM::call(const FunctionHandle& function, Args&&... args)
 {
     using namespace Ark::internal;
 
-    const std::lock_guard<std::mutex> lock(m_mutex);
+    // the page address or the scope of the function may not exist anymore
+    if (function.m_vm != this || function.m_generation != m_generation)
+        throwVMError("Can't call a function handle found by another VM, or before this one was reset");
 
     // reset ip and pp
     m_ip = 0;
     m_pp = 0;
+    // the caller needs the result now, the function can't be suspended
+    bool can_suspend = m_can_suspend;
+    m_can_suspend = false;
 
-    // find id of function
-    auto it = std::find(m_state->m_symbols.begin(), m_state->m_symbols.end(), name);
-    if (it == m_state->m_symbols.end())
-        throwVMError("unbound variable: " + name);
-
-    // convert and push arguments in reverse order
-    std::vector<Value> fnargs { { Value(args)... } };
-    for (auto it2=fnargs.rbegin(), it_end=fnargs.rend(); it2 != it_end; ++it2)
-        m_frames.back().push(*it2);
+    // convert and push arguments, the first one being the deepest in the stack as for the calls made by the bytecode
+    std::array<Value, sizeof...(Args)> fnargs { { Value(std::forward<Args>(args))... } };
+    for (Value& arg : fnargs)
+        m_frames.back().push(std::move(arg));
 
-    // find function object and push it if it's a pageaddr/closure
-    uint16_t id = static_cast<uint16_t>(std::distance(m_state->m_symbols.begin(), it));
-    auto var = findNearestVariable(id);
-    if (var != nullptr)
-    {
-        if (var->valueType() != ValueType::PageAddr && var->valueType() != ValueType::Closure)
-            throwVMError("Can't call '" + name + "': it isn't a Function but a " + types_to_str[static_cast<int>(var->valueType())]);
-
-        m_frames.back().push(*var);
-        m_last_sym_loaded = id;
-    }
-    else
-        throwVMError("Couldn't find variable " + name);
+    m_frames.back().push(function.m_function);
+    m_last_sym_loaded = function.m_id;
 
     std::size_t frames_count = m_frames.size();
     // call it
@@ -49,10 +46,15 @@ internal::Value VM::call(const std::string& name, Args&&... args)
 
     // run until the function returns
     safeRun(/* untilFrameCount */ frames_count);
+    m_can_suspend = can_suspend;
 
-    // get result
+    // get result, the host reads its lists with const_list
     if (m_frames.back().stackSize() != 0)
-        return *m_frames.back().pop();
+    {
+        Value result = *m_frames.back().pop();
+        result.unshareLists();
+        return result;
+    }
     else
         return Builtins::nil;
 }
@@ -67,6 +69,20 @@ inline internal::Value* VM::findNearestVariable(uint16_t id) noexcept
     return nullptr;
 }
 
+inline internal::Value* VM::findListToModify(uint16_t id, const char* name)
+{
+    using namespace internal;
+
+    Value* var = findNearestVariable(id);
+    if (var == nullptr)
+        throwVMError("unbound variable " + m_state->m_symbols[id] + ", can not change its value");
+    if (var->isConst())
+        throwVMError("can not modify a constant: " + m_state->m_symbols[id]);
+    if (var->valueType() != ValueType::List)
+        throw Ark::TypeError(std::string(name) + " needs a variable holding a list");
+    return var;
+}
+
 inline void VM::returnFromFuncCall()
 {
     // remove frame
@@ -89,6 +105,17 @@ inline void VM::returnFromFuncCall()
         m_running = false;
 }
 
+inline void VM::updateMemoryCounters() noexcept
+{
+    m_memory.frames_created++;
+    m_memory.scopes_created++;
+
+    if (m_frames.size() > m_memory.max_frames)
+        m_memory.max_frames = m_frames.size();
+    if (m_locals.size() > m_memory.max_locals)
+        m_memory.max_locals = m_locals.size();
+}
+
 inline void VM::call(int16_t argc_)
 {
     /*
@@ -119,10 +146,24 @@ inline void VM::call(int16_t argc_)
         // is it a builtin function name?
         case ValueType::CProc:
         {
-            // drop arguments from the stack
+            if (auto fast_proc = std::get_if<Value::FastProcType>(&function.m_value))
+            {
+                // the arguments are already in order on top of the stack, the builtin reads them in place
+                Frame& frame = m_frames.back();
+                ArgsView args(&frame.m_stack[frame.m_i - argc], argc, &m_frames, m_frames.size() - 1, frame.m_stack.data());
+                Value result = (*fast_proc)(args, this);
+                m_frames.back().drop(argc);
+                m_frames.back().push(std::move(result));
+                return;
+            }
+
+            // drop arguments from the stack, the plugins read their lists with const_list
             std::vector<Value> args(argc);
             for (uint16_t j=0; j < argc; ++j)
+            {
                 args[argc - 1 - j] = *m_frames.back().pop();
+                args[argc - 1 - j].unshareLists();
+            }
 
             // call proc
             m_frames.back().push(function.proc()(args, this));
@@ -137,7 +178,10 @@ inline void VM::call(int16_t argc_)
 
             // create dedicated frame
             createNewScope();
+            // room for the variables of the function plus the reference to itself
+            m_locals.back()->reserve(m_state->m_pages_metadata[new_page_pointer].locals_count + 1);
             m_frames.emplace_back(m_ip, static_cast<uint16_t>(m_pp), new_page_pointer);
+            updateMemoryCounters();
             // store "reference" to the function to speed the recursive functions
             if (m_last_sym_loaded < m_state->m_symbols.size())
                 m_locals.back()->push_back(m_last_sym_loaded, function);
@@ -160,8 +204,10 @@ inline void VM::call(int16_t argc_)
             m_locals.push_back(c.scope());
             // create dedicated frame
             createNewScope();
+            m_locals.back()->reserve(m_state->m_pages_metadata[new_page_pointer].locals_count);
             m_frames.back().incScopeCountToDelete();
             m_frames.emplace_back(m_ip, static_cast<uint16_t>(m_pp), new_page_pointer);
+            updateMemoryCounters();
 
             m_pp = new_page_pointer;
             m_ip = -1;  // because we are doing a m_ip++ right after that
@@ -177,19 +223,17 @@ inline void VM::call(int16_t argc_)
     // checking function arity
     if (m_state->m_options & FeatureFunctionArityCheck)
     {
-        std::size_t index = 0,
-                    needed_argc = 0,
+        // computed once when the bytecode was loaded
+        std::size_t needed_argc = m_state->m_pages_metadata[m_pp].arity,
                     received_argc = m_frames.back().stackSize();
 
-        // every argument is a MUT declaration in the bytecode
-        while (m_state->m_pages[m_pp][index] == Instruction::MUT)
+        if (needed_argc != received_argc)
         {
-            needed_argc += 1;
-            index += 3;  // jump the argument of MUT (integer on 2 bits, big endian)
+            // functions called through resolve weren't loaded from a symbol
+            uint16_t id = m_last_sym_loaded < m_state->m_symbols.size() ? m_last_sym_loaded : m_state->m_pages_metadata[m_pp].name_id;
+            std::string name = id < m_state->m_symbols.size() ? m_state->m_symbols[id] : "<anonymous>";
+            throwVMError("Function '" + name + "' needs " + Ark::Utils::toString(needed_argc) + " arguments, but it received " + Ark::Utils::toString(received_argc));
         }
-
-        if (needed_argc != received_argc)
-            throwVMError("Function '" + m_state->m_symbols[m_last_sym_loaded] + "' needs " + Ark::Utils::toString(needed_argc) + " arguments, but it received " + Ark::Utils::toString(received_argc));
     }
 }
 
@@ -198,18 +242,27 @@ internal::Value VM::resolve(const internal::Value* val, Args&&... args)
 {
     using namespace Ark::internal;
 
-    const std::lock_guard<std::mutex> lock(m_mutex);
+    const std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
     if (!val->isFunction())
         throw Ark::TypeError("Value::resolve couldn't resolve a non-function");
 
     int ip = m_ip;
     std::size_t pp = m_pp;
-
-    // convert and push arguments in reverse order
-    std::vector<Value> fnargs { { Value(args)... } };
-    for (auto it=fnargs.rbegin(), it_end=fnargs.rend(); it != it_end; ++it)
-        m_frames.back().push(*it);
+    uint16_t last_sym = m_last_sym_loaded;
+    // a builtin can call a function while the VM is running, the loop running it must continue afterward
+    std::size_t until_frame_count = m_until_frame_count;
+    bool running = m_running;
+    // the function wasn't loaded from a symbol, it must not be stored in its scope under the last one loaded
+    m_last_sym_loaded = 0xffff;
+    // the builtin calling this function needs its result now, it can't be suspended
+    bool can_suspend = m_can_suspend;
+    m_can_suspend = false;
+
+    // convert and push arguments, the first one being the deepest in the stack as for the calls made by the bytecode
+    std::array<Value, sizeof...(Args)> fnargs { { Value(std::forward<Args>(args))... } };
+    for (Value& arg : fnargs)
+        m_frames.back().push(std::move(arg));
     // push function
     m_frames.back().push(*val);
 
@@ -227,6 +280,10 @@ internal::Value VM::resolve(const internal::Value* val, Args&&... args)
     // restore VM state
     m_ip = ip;
     m_pp = pp;
+    m_last_sym_loaded = last_sym;
+    m_can_suspend = can_suspend;
+    m_until_frame_count = until_frame_count;
+    m_running = running;
 
     // get result
     if (m_frames.back().stackSize() != 0)
@@ -24,14 +24,46 @@ inline const String& Value::string() const
 
 inline const std::vector<Value>& Value::const_list() const
 {
+    // a view over a whole buffer reads it in place
+    if (const ListSlice* slice = std::get_if<ListSlice>(&m_value); slice != nullptr && slice->offset == 0 && slice->size == slice->buffer->size())
+        return *slice->buffer;
     return std::get<std::vector<Value>>(m_value);
 }
 
+inline std::size_t Value::listSize() const
+{
+    if (const ListSlice* slice = std::get_if<ListSlice>(&m_value))
+        return slice->size;
+    return std::get<std::vector<Value>>(m_value).size();
+}
+
+inline const Value* Value::listData() const
+{
+    if (const ListSlice* slice = std::get_if<ListSlice>(&m_value))
+        return slice->buffer->data() + slice->offset;
+    return std::get<std::vector<Value>>(m_value).data();
+}
+
 inline const UserType& Value::usertype() const
 {
     return std::get<UserType>(m_value);
 }
 
+inline const Dict& Value::const_dict() const
+{
+    return *std::get<std::shared_ptr<Dict>>(m_value);
+}
+
+inline const std::vector<double>& Value::const_array() const
+{
+    return *std::get<std::shared_ptr<std::vector<double>>>(m_value);
+}
+
+inline const Range& Value::const_range() const
+{
+    return *std::get<std::shared_ptr<Range>>(m_value);
+}
+
 // private getters
 
 inline PageAddr_t Value::pageAddr() const
@@ -39,6 +71,18 @@ inline PageAddr_t Value::pageAddr() const
     return std::get<PageAddr_t>(m_value);
 }
 
+inline double& Value::number_ref() noexcept
+{
+    return *std::get_if<double>(&m_value);
+}
+
+inline void Value::setBool(bool value) noexcept
+{
+    // True and False hold a 0.0 like the ones created with Value(ValueType), for the comparisons
+    m_value = 0.0;
+    m_constType = static_cast<uint8_t>(value ? ValueType::True : ValueType::False);
+}
+
 inline const Value::ProcType& Value::proc() const
 {
     return std::get<Value::ProcType>(m_value);
@@ -64,6 +108,19 @@ inline void Value::setConst(bool value) noexcept
 
 // operators
 
+inline bool operator==(const ListSlice& A, const ListSlice& B) noexcept
+{
+    const Value* a = A.buffer->data() + A.offset;
+    return A.size == B.size && std::equal(a, a + A.size, B.buffer->data() + B.offset);
+}
+
+inline bool operator<(const ListSlice& A, const ListSlice& B) noexcept
+{
+    const Value* a = A.buffer->data() + A.offset;
+    const Value* b = B.buffer->data() + B.offset;
+    return std::lexicographical_compare(a, a + A.size, b, b + B.size);
+}
+
 inline bool operator==(const Value& A, const Value& B) noexcept
 {
     // values should have the same type
@@ -72,6 +129,16 @@ inline bool operator==(const Value& A, const Value& B) noexcept
     // all the types >= Nil are Nil itself, True, False, Undefined
     else if ((A.m_constType & 0b01111111) >= static_cast<int>(ValueType::Nil))
         return true;
+    // the dictionaries are compared by content, not by address
+    else if (A.valueType() == ValueType::Dict)
+        return A.const_dict() == B.const_dict();
+    else if (A.valueType() == ValueType::Range)
+        return A.const_range() == B.const_range();
+    else if (A.valueType() == ValueType::Array)
+        return A.const_array() == B.const_array();
+    // a list can be a vector or a slice
+    else if (A.valueType() == ValueType::List)
+        return A.listSize() == B.listSize() && std::equal(A.listData(), A.listData() + A.listSize(), B.listData());
 
     return A.m_value == B.m_value;
 }
@@ -80,6 +147,10 @@ inline bool operator<(const Value& A, const Value& B) noexcept
 {
     if (A.valueType() != B.valueType())
         return (static_cast<int>(A.valueType()) - static_cast<int>(B.valueType())) < 0;
+    else if (A.valueType() == ValueType::List)
+        return std::lexicographical_compare(A.listData(), A.listData() + A.listSize(), B.listData(), B.listData() + B.listSize());
+    else if (A.valueType() == ValueType::Array)
+        return A.const_array() < B.const_array();
     return A.m_value < B.m_value;
 }
 
@@ -93,7 +164,7 @@ inline bool operator!(const Value& A) noexcept
     switch (A.valueType())
     {
         case ValueType::List:
-            return A.const_list().empty();
+            return A.listSize() == 0;
 
         case ValueType::Number:
             return !A.number();
@@ -101,6 +172,15 @@ inline bool operator!(const Value& A) noexcept
         case ValueType::String:
             return A.string().size() == 0;
 
+        case ValueType::Dict:
+            return isEmpty(A.const_dict());
+
+        case ValueType::Array:
+            return A.const_array().empty();
+
+        case ValueType::Range:
+            return isEmpty(A.const_range());
+
         case ValueType::User:
         case ValueType::Nil:
         case ValueType::False:
@@ -112,4 +192,40 @@ inline bool operator!(const Value& A) noexcept
         default:
             return false;
     }
-}
\ No newline at end of file
+}
+
+// ArgsView
+
+inline Value& ArgsView::operator[](std::size_t index) noexcept
+{
+    assert(valid() && "the arguments of a builtin were read after calling back into the VM");
+    return m_data[index];
+}
+
+inline const Value& ArgsView::operator[](std::size_t index) const noexcept
+{
+    assert(valid() && "the arguments of a builtin were read after calling back into the VM");
+    return m_data[index];
+}
+
+inline std::size_t ArgsView::size() const noexcept
+{
+    return m_size;
+}
+
+inline bool ArgsView::empty() const noexcept
+{
+    return m_size == 0;
+}
+
+inline ArgsView::Iterator ArgsView::begin() noexcept
+{
+    assert(valid() && "the arguments of a builtin were read after calling back into the VM");
+    return m_data;
+}
+
+inline ArgsView::Iterator ArgsView::end() noexcept
+{
+    assert(valid() && "the arguments of a builtin were read after calling back into the VM");
+    return m_data + m_size;
+}
@@ -0,0 +1,174 @@
+#include <Ark/Builtins/Builtins.hpp>
+
+#include <Ark/Builtins/BuiltinsErrors.inl>
+#include <Ark/VM/VM.hpp>
+#include <Ark/VM/Kernels.hpp>
+
+namespace Ark::internal::Builtins::Array
+{
+    Value array(ArgsView n, Ark::VM* vm)
+    {
+        std::vector<double> output;
+        output.reserve(n.size());
+        for (const Value& value : n)
+        {
+            if (value.valueType() != ValueType::Number)
+                throw Ark::TypeError(ARRAY_TE);
+            output.push_back(value.number());
+        }
+
+        return Value(std::move(output));
+    }
+
+    Value fromList(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(ARRAY_FROMLIST_ARITY);
+        if (n[0].valueType() != ValueType::List)
+            throw Ark::TypeError(ARRAY_FROMLIST_TE0);
+
+        const Value* list = n[0].listData();
+        std::vector<double> output(n[0].listSize());
+        for (std::size_t i = 0, end = output.size(); i < end; ++i)
+        {
+            if (list[i].valueType() != ValueType::Number)
+                throw Ark::TypeError(ARRAY_FROMLIST_TE0);
+            output[i] = list[i].number();
+        }
+
+        return Value(std::move(output));
+    }
+
+    Value toList(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(ARRAY_TOLIST_ARITY);
+        if (n[0].valueType() != ValueType::Array)
+            throw Ark::TypeError(ARRAY_TOLIST_TE0);
+
+        std::vector<Value> output;
+        output.reserve(n[0].const_array().size());
+        for (double d : n[0].const_array())
+            output.emplace_back(d);
+
+        return Value(std::move(output));
+    }
+
+    Value add(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 2)
+            throw std::runtime_error(ARRAY_ADD_ARITY);
+        if (n[0].valueType() != ValueType::Array || n[1].valueType() != ValueType::Array)
+            throw Ark::TypeError(ARRAY_ADD_TE);
+
+        const std::vector<double>& a = n[0].const_array();
+        const std::vector<double>& b = n[1].const_array();
+        if (a.size() != b.size())
+            throw std::runtime_error(ARRAY_ADD_SIZE);
+
+        std::vector<double> output(a.size());
+        kernels::add(a.data(), b.data(), output.data(), a.size());
+
+        return Value(std::move(output));
+    }
+
+    Value mul(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 2)
+            throw std::runtime_error(ARRAY_MUL_ARITY);
+        if (n[0].valueType() != ValueType::Array || n[1].valueType() != ValueType::Array)
+            throw Ark::TypeError(ARRAY_MUL_TE);
+
+        const std::vector<double>& a = n[0].const_array();
+        const std::vector<double>& b = n[1].const_array();
+        if (a.size() != b.size())
+            throw std::runtime_error(ARRAY_MUL_SIZE);
+
+        std::vector<double> output(a.size());
+        kernels::mul(a.data(), b.data(), output.data(), a.size());
+
+        return Value(std::move(output));
+    }
+
+    Value scale(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 2)
+            throw std::runtime_error(ARRAY_SCALE_ARITY);
+        if (n[0].valueType() != ValueType::Array)
+            throw Ark::TypeError(ARRAY_SCALE_TE0);
+        if (n[1].valueType() != ValueType::Number)
+            throw Ark::TypeError(ARRAY_SCALE_TE1);
+
+        const std::vector<double>& a = n[0].const_array();
+        std::vector<double> output(a.size());
+        kernels::scale(a.data(), n[1].number(), output.data(), a.size());
+
+        return Value(std::move(output));
+    }
+
+    Value sum(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(ARRAY_SUM_ARITY);
+        if (n[0].valueType() != ValueType::Array)
+            throw Ark::TypeError(ARRAY_SUM_TE0);
+
+        const std::vector<double>& a = n[0].const_array();
+        return Value(kernels::sum(a.data(), a.size()));
+    }
+
+    Value min(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(ARRAY_MIN_ARITY);
+        if (n[0].valueType() != ValueType::Array)
+            throw Ark::TypeError(ARRAY_MIN_TE0);
+
+        const std::vector<double>& a = n[0].const_array();
+        if (a.empty())
+            throw std::runtime_error(ARRAY_MIN_EMPTY);
+        return Value(kernels::min(a.data(), a.size()));
+    }
+
+    Value max(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(ARRAY_MAX_ARITY);
+        if (n[0].valueType() != ValueType::Array)
+            throw Ark::TypeError(ARRAY_MAX_TE0);
+
+        const std::vector<double>& a = n[0].const_array();
+        if (a.empty())
+            throw std::runtime_error(ARRAY_MAX_EMPTY);
+        return Value(kernels::max(a.data(), a.size()));
+    }
+
+    Value dot(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 2)
+            throw std::runtime_error(ARRAY_DOT_ARITY);
+        if (n[0].valueType() != ValueType::Array || n[1].valueType() != ValueType::Array)
+            throw Ark::TypeError(ARRAY_DOT_TE);
+
+        const std::vector<double>& a = n[0].const_array();
+        const std::vector<double>& b = n[1].const_array();
+        if (a.size() != b.size())
+            throw std::runtime_error(ARRAY_DOT_SIZE);
+
+        return Value(kernels::dot(a.data(), b.data(), a.size()));
+    }
+
+    Value prefixSum(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(ARRAY_PREFIXSUM_ARITY);
+        if (n[0].valueType() != ValueType::Array)
+            throw Ark::TypeError(ARRAY_PREFIXSUM_TE0);
+
+        const std::vector<double>& a = n[0].const_array();
+        std::vector<double> output(a.size());
+        kernels::prefixSum(a.data(), output.data(), a.size());
+
+        return Value(std::move(output));
+    }
+}
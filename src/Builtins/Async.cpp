@@ -0,0 +1,89 @@
+#include <Ark/Builtins/Builtins.hpp>
+
+#undef abs
+#include <chrono>
+#include <fstream>
+
+#include <Ark/Builtins/BuiltinsErrors.inl>
+#include <Ark/VM/VM.hpp>
+
+namespace Ark::internal::Builtins::Async
+{
+    Value spawn(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() < 1)
+            throw std::runtime_error(ASYNC_SPAWN_ARITY);
+        if (!n[0].isFunction())
+            throw Ark::TypeError(ASYNC_SPAWN_TE0);
+
+        std::vector<Value> args(n.begin() + 1, n.end());
+        return Value(static_cast<double>(vm->spawn(n[0], std::move(args))));
+    }
+
+    Value await(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(ASYNC_AWAIT_ARITY);
+        if (n[0].valueType() != ValueType::Number)
+            throw Ark::TypeError(ASYNC_AWAIT_TE0);
+
+        return vm->await(static_cast<std::size_t>(n[0].number()));
+    }
+
+    Value sleep(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(ASYNC_SLEEP_ARITY);
+        if (n[0].valueType() != ValueType::Number)
+            throw Ark::TypeError(ASYNC_SLEEP_TE0);
+
+        auto duration = std::chrono::duration<double, std::ratio<1, 1000>>(n[0].number());
+        auto deadline = EventLoop::Clock::now() + std::chrono::duration_cast<EventLoop::Clock::duration>(duration);
+        vm->eventLoop().addTimer(vm->suspend(), deadline);
+
+        return nil;
+    }
+
+    Value readFile(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(ASYNC_READ_ARITY);
+        if (n[0].valueType() != ValueType::String)
+            throw Ark::TypeError(ASYNC_READ_TE0);
+
+        // checked now to report the error in the task which asked for the file
+        std::string filename = n[0].string().c_str();
+        if (!Ark::Utils::fileExists(filename))
+            throw std::runtime_error("Couldn't read file \"" + filename + "\": it doesn't exist");
+
+        vm->eventLoop().submit(vm->suspend(), [filename]() {
+            return Value(Ark::Utils::readFile(filename));
+        });
+
+        return nil;
+    }
+
+    Value writeFile(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 2)
+            throw std::runtime_error(ASYNC_WRITE_ARITY);
+        if (n[0].valueType() != ValueType::String)
+            throw Ark::TypeError(ASYNC_WRITE_TE0);
+        if (n[1].valueType() != ValueType::String)
+            throw Ark::TypeError(ASYNC_WRITE_TE1);
+
+        std::string filename = n[0].string().c_str();
+        std::string content = n[1].string().c_str();
+
+        // the task gets true once the file is written, false if it couldn't be opened
+        vm->eventLoop().submit(vm->suspend(), [filename, content]() {
+            std::ofstream f(filename);
+            if (!f.is_open())
+                return falseSym;
+            f << content;
+            return f.good() ? trueSym : falseSym;
+        });
+
+        return nil;
+    }
+}
@@ -4,7 +4,7 @@
 
 #include <Ark/Builtins/Builtins.hpp>
 
-#define Builtins_Function(name) Value name(std::vector<Value>& n)
+#define Builtins_Function(name) Value name(ArgsView n)
 
 namespace Ark::internal::Builtins
 {
@@ -33,8 +33,44 @@ namespace Ark::internal::Builtins
         { "list:removeAt", Value(List::removeAtList) },
         { "list:slice", Value(List::sliceList) },
         { "list:sort", Value(List::sort_) },
+        { "list:sortBy", Value(List::sortBy) },
         { "list:fill", Value(List::fill) },
         { "list:setAt", Value(List::setListAt) },
+        { "list:pmap", Value(List::parallelMap) },
+        { "list:pfilter", Value(List::parallelFilter) },
+        { "list:preduce", Value(List::parallelReduce) },
+
+        // Dict
+        { "dict", Value(Dictionary::dict) },
+        { "dict:get", Value(Dictionary::get) },
+        { "dict:set", Value(Dictionary::set) },
+        { "dict:has?", Value(Dictionary::has) },
+        { "dict:remove", Value(Dictionary::remove) },
+        { "dict:keys", Value(Dictionary::keys) },
+        { "dict:values", Value(Dictionary::values) },
+        { "dict:size", Value(Dictionary::size) },
+        { "dict:copy", Value(Dictionary::copy) },
+
+        // Array
+        { "array", Value(Array::array) },
+        { "array:fromList", Value(Array::fromList) },
+        { "array:toList", Value(Array::toList) },
+        { "array:add", Value(Array::add) },
+        { "array:mul", Value(Array::mul) },
+        { "array:scale", Value(Array::scale) },
+        { "array:sum", Value(Array::sum) },
+        { "array:min", Value(Array::min) },
+        { "array:max", Value(Array::max) },
+        { "array:dot", Value(Array::dot) },
+        { "array:prefixSum", Value(Array::prefixSum) },
+
+        // Iterator
+        { "iter:range", Value(Iterator::range) },
+        { "iter:next", Value(Iterator::next) },
+        { "iter:done?", Value(Iterator::done) },
+        { "iter:reset", Value(Iterator::reset) },
+        { "iter:toList", Value(Iterator::toList) },
+        { "iter:copy", Value(Iterator::copy) },
 
         // IO
         { "print",  Value(IO::print) },
@@ -42,11 +78,16 @@ namespace Ark::internal::Builtins
         { "input",  Value(IO::input) },
         { "io:writeFile", Value(IO::writeFile) },
         { "io:readFile", Value(IO::readFile) },
+        { "io:open", Value(IO::open) },
+        { "io:readLine", Value(IO::readLine) },
+        { "io:readChunk", Value(IO::readChunk) },
+        { "io:close", Value(IO::close) },
         { "io:fileExists?", Value(IO::fileExists) },
         { "io:listFiles", Value(IO::listFiles) },
         { "io:dir?", Value(IO::isDirectory) },
         { "io:makeDir", Value(IO::makeDir) },
         { "io:removeFiles", Value(IO::removeFiles) },
+        { "io:flush", Value(IO::flush) },
 
         // Time
         { "time", Value(Time::timeSinceEpoch) },
@@ -55,11 +96,22 @@ namespace Ark::internal::Builtins
         { "sys:exec", Value(System::system_) },
         { "sys:sleep", Value(System::sleep) },
         { "sys:exit", Value(System::exit_) },
+        { "sys:memory", Value(System::memory) },
+        { "sys:gc", Value(System::gc) },
+
+        // Async
+        { "async:spawn", Value(Async::spawn) },
+        { "async:await", Value(Async::await) },
+        { "async:sleep", Value(Async::sleep) },
+        { "async:readFile", Value(Async::readFile) },
+        { "async:writeFile", Value(Async::writeFile) },
 
         // String
         { "str:format", Value(String::format) },
         { "str:find", Value(String::findSubStr) },
         { "str:removeAt", Value(String::removeAtStr) },
+        { "str:builder", Value(String::builder) },
+        { "str:build", Value(String::build) },
 
         // Mathematics
         { "math:exp", Value(Mathematics::exponential) },
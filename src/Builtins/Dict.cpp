@@ -0,0 +1,129 @@
+#include <Ark/Builtins/Builtins.hpp>
+
+#include <Ark/Builtins/BuiltinsErrors.inl>
+#include <Ark/VM/VM.hpp>
+#include <Ark/VM/Dict.hpp>
+
+namespace Ark::internal::Builtins::Dictionary
+{
+    Value dict(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() % 2 != 0)
+            throw std::runtime_error(DICT_ARITY);
+
+        Value output(ValueType::Dict);
+        Dict& d = output.dict();
+        for (std::size_t i = 0, end = n.size(); i < end; i += 2)
+        {
+            if (!Dict::isHashable(n[i]))
+                throw Ark::TypeError(DICT_KEY_TE);
+            d.set(n[i], n[i + 1]);
+        }
+        // it can end up holding itself, or closures capturing it
+        vm->trackDict(output);
+
+        return output;
+    }
+
+    Value get(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 2 && n.size() != 3)
+            throw std::runtime_error(DICT_GET_ARITY);
+        if (n[0].valueType() != ValueType::Dict)
+            throw Ark::TypeError(DICT_GET_TE0);
+        if (!Dict::isHashable(n[1]))
+            throw Ark::TypeError(DICT_GET_TE1);
+
+        if (const Value* value = n[0].const_dict().find(n[1]))
+            return *value;
+        return n.size() == 3 ? n[2] : nil;
+    }
+
+    Value set(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 3)
+            throw std::runtime_error(DICT_SET_ARITY);
+        if (n[0].valueType() != ValueType::Dict)
+            throw Ark::TypeError(DICT_SET_TE0);
+        if (!Dict::isHashable(n[1]))
+            throw Ark::TypeError(DICT_SET_TE1);
+        if (n[0].isConst())
+            throw std::runtime_error(DICT_SET_CONST);
+
+        n[0].dict().set(n[1], n[2]);
+
+        return n[0];
+    }
+
+    Value has(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 2)
+            throw std::runtime_error(DICT_HAS_ARITY);
+        if (n[0].valueType() != ValueType::Dict)
+            throw Ark::TypeError(DICT_HAS_TE0);
+        if (!Dict::isHashable(n[1]))
+            throw Ark::TypeError(DICT_HAS_TE1);
+
+        return n[0].const_dict().find(n[1]) != nullptr ? trueSym : falseSym;
+    }
+
+    Value remove(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 2)
+            throw std::runtime_error(DICT_REMOVE_ARITY);
+        if (n[0].valueType() != ValueType::Dict)
+            throw Ark::TypeError(DICT_REMOVE_TE0);
+        if (!Dict::isHashable(n[1]))
+            throw Ark::TypeError(DICT_REMOVE_TE1);
+        if (n[0].isConst())
+            throw std::runtime_error(DICT_REMOVE_CONST);
+
+        n[0].dict().remove(n[1]);
+
+        return n[0];
+    }
+
+    Value keys(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(DICT_KEYS_ARITY);
+        if (n[0].valueType() != ValueType::Dict)
+            throw Ark::TypeError(DICT_KEYS_TE0);
+
+        return Value(n[0].const_dict().keys());
+    }
+
+    Value values(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(DICT_VALUES_ARITY);
+        if (n[0].valueType() != ValueType::Dict)
+            throw Ark::TypeError(DICT_VALUES_TE0);
+
+        return Value(n[0].const_dict().values());
+    }
+
+    Value size(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(DICT_SIZE_ARITY);
+        if (n[0].valueType() != ValueType::Dict)
+            throw Ark::TypeError(DICT_SIZE_TE0);
+
+        return Value(static_cast<double>(n[0].const_dict().size()));
+    }
+
+    Value copy(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(DICT_COPY_ARITY);
+        if (n[0].valueType() != ValueType::Dict)
+            throw Ark::TypeError(DICT_COPY_TE0);
+
+        // the entries are copied when one of the dictionaries is modified
+        Value output(std::make_shared<Dict>(n[0].const_dict()));
+        vm->trackDict(output);
+
+        return output;
+    }
+}
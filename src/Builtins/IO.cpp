@@ -1,7 +1,10 @@
 #include <Ark/Builtins/Builtins.hpp>
 
 #include <iostream>
+#include <atomic>
 #include <filesystem>
+#include <cstdio>
+#include <cstring>
 
 #include <Ark/Utils.hpp>
 #include <Ark/VM/VM.hpp>
@@ -9,31 +12,177 @@
 
 namespace Ark::internal::Builtins::IO
 {
-    Value print(std::vector<Value>& n, Ark::VM* vm)
+    namespace
     {
-        for (Value::Iterator it=n.begin(), it_end=n.end(); it != it_end; ++it)
-            std::cout << (*it);
-        std::cout << std::endl;
+        /**
+         * @brief File opened by io:open, read through a fixed size buffer so that the memory used doesn't depend on the size of the file
+         * 
+         */
+        class FileReader
+        {
+        public:
+            static constexpr std::size_t BufferSize = 64 * 1024;
+
+            FileReader(std::FILE* file, const std::string& filename) :
+                m_file(file), m_filename(filename), m_buffer(BufferSize)
+            {}
+
+            ~FileReader()
+            {
+                close();
+            }
+
+            void close() noexcept
+            {
+                if (m_file != nullptr)
+                    std::fclose(m_file);
+                m_file = nullptr;
+                m_begin = m_end = 0;
+            }
+
+            bool isOpen() const noexcept
+            {
+                return m_file != nullptr;
+            }
+
+            const std::string& filename() const noexcept
+            {
+                return m_filename;
+            }
+
+            /**
+             * @brief Read the next line, without its line ending
+             * 
+             * @param line 
+             * @return false if the end of the file was reached before reading anything
+             */
+            bool readLine(std::string& line)
+            {
+                bool read_something = false;
+                while (m_begin != m_end || fill())
+                {
+                    read_something = true;
+                    const char* begin = m_buffer.data() + m_begin;
+                    const char* newline = static_cast<const char*>(std::memchr(begin, '\n', m_end - m_begin));
+                    if (newline != nullptr)
+                    {
+                        line.append(begin, newline);
+                        m_begin += (newline - begin) + 1;
+                        break;
+                    }
+                    line.append(begin, m_end - m_begin);
+                    m_begin = m_end;
+                }
+
+                if (!line.empty() && line.back() == '\r')
+                    line.pop_back();
+                return read_something;
+            }
+
+            /**
+             * @brief Read up to size bytes
+             * 
+             * @param size 
+             * @param chunk 
+             * @return false if the end of the file was reached before reading anything
+             */
+            bool readChunk(std::size_t size, std::string& chunk)
+            {
+                while (chunk.size() < size && (m_begin != m_end || fill()))
+                {
+                    std::size_t count = std::min(size - chunk.size(), m_end - m_begin);
+                    chunk.append(m_buffer.data() + m_begin, count);
+                    m_begin += count;
+                }
+                return !chunk.empty();
+            }
+
+            std::atomic<std::size_t> refs { 1 };  ///< the copies can be destroyed by the VMs of other threads
+
+        private:
+            bool fill()
+            {
+                if (m_file == nullptr)
+                    return false;
+                m_begin = 0;
+                m_end = std::fread(m_buffer.data(), 1, m_buffer.size(), m_file);
+                return m_end != 0;
+            }
+
+            std::FILE* m_file;
+            std::string m_filename;
+            std::vector<char> m_buffer;
+            std::size_t m_begin = 0;
+            std::size_t m_end = 0;
+        };
+
+        std::ostream& printFile(std::ostream& os, const UserType& file)
+        {
+            return os << "File<" << file.as<FileReader>().filename() << ">";
+        }
+
+        void copyFile(void* data)
+        {
+            ++static_cast<FileReader*>(data)->refs;
+        }
+
+        // the file is closed when the last value holding it is destroyed
+        void deleteFile(void* data)
+        {
+            FileReader* file = static_cast<FileReader*>(data);
+            if (--file->refs == 0)
+                delete file;
+        }
+
+        UserType::ControlFuncs file_funcs = { printFile, deleteFile, copyFile };
+
+        FileReader& getFile(Value& value, const char* error)
+        {
+            if (value.valueType() != ValueType::User || !value.usertype().is<FileReader>())
+                throw Ark::TypeError(error);
+            return value.usertype_ref().as<FileReader>();
+        }
+    }
+
+    Value print(ArgsView n, Ark::VM* vm)
+    {
+        std::ostream& os = vm->output();
+        for (ArgsView::Iterator it=n.begin(), it_end=n.end(); it != it_end; ++it)
+            os << (*it);
+        // no std::endl: flushing on every call is what made printing slow
+        os << '\n';
 
         return nil;
     }
 
-    Value puts_(std::vector<Value>& n, Ark::VM* vm)
+    Value puts_(ArgsView n, Ark::VM* vm)
     {
-        for (Value::Iterator it=n.begin(), it_end=n.end(); it != it_end; ++it)
-            std::cout << (*it);
+        std::ostream& os = vm->output();
+        for (ArgsView::Iterator it=n.begin(), it_end=n.end(); it != it_end; ++it)
+            os << (*it);
 
         return nil;
     }
 
-    Value input(std::vector<Value>& n, Ark::VM* vm)
+    Value flush(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 0)
+            throw std::runtime_error(IO_FLUSH_ARITY);
+
+        vm->flush();
+        return nil;
+    }
+
+    Value input(ArgsView n, Ark::VM* vm)
     {
         if (n.size() == 1)
         {
             if (n[0].valueType() != ValueType::String)
                 throw Ark::TypeError(IO_INPUT_TE);
-            std::cout << n[0].string().c_str();
+            vm->output() << n[0].string().c_str();
         }
+        // the prompt and what was printed before must be visible before waiting for the user
+        vm->flush();
 
         std::string line = "";
         std::getline(std::cin, line);
@@ -41,7 +190,7 @@ namespace Ark::internal::Builtins::IO
         return Value(line);
     }
 
-    Value writeFile(std::vector<Value>& n, Ark::VM* vm)
+    Value writeFile(ArgsView n, Ark::VM* vm)
     {
         // filename, content
         if (n.size() == 2)
@@ -88,7 +237,7 @@ namespace Ark::internal::Builtins::IO
         return nil;
     }
 
-    Value readFile(std::vector<Value>& n, Ark::VM* vm)
+    Value readFile(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(IO_READ_ARITY);
@@ -102,7 +251,59 @@ namespace Ark::internal::Builtins::IO
         return Value(Ark::Utils::readFile(filename));
     }
 
-    Value fileExists(std::vector<Value>& n, Ark::VM* vm)
+    Value open(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(IO_OPEN_ARITY);
+        if (n[0].valueType() != ValueType::String)
+            throw Ark::TypeError(IO_OPEN_TE0);
+
+        std::string filename = n[0].string_ref().toString();
+        std::FILE* f = std::fopen(filename.c_str(), "rb");
+        if (f == nullptr)
+            throw std::runtime_error("Couldn't open file \"" + filename + "\"");
+
+        UserType file(new FileReader(f, filename));
+        file.setControlFuncs(&file_funcs);
+        return Value(std::move(file));
+    }
+
+    Value readLine(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(IO_READLINE_ARITY);
+        FileReader& file = getFile(n[0], IO_READLINE_TE0);
+
+        std::string line;
+        if (!file.readLine(line))
+            return nil;
+        return Value(std::move(line));
+    }
+
+    Value readChunk(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 2)
+            throw std::runtime_error(IO_READCHUNK_ARITY);
+        FileReader& file = getFile(n[0], IO_READCHUNK_TE0);
+        if (n[1].valueType() != ValueType::Number || n[1].number() < 1)
+            throw Ark::TypeError(IO_READCHUNK_TE1);
+
+        std::string chunk;
+        if (!file.readChunk(static_cast<std::size_t>(n[1].number()), chunk))
+            return nil;
+        return Value(std::move(chunk));
+    }
+
+    Value close(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(IO_CLOSE_ARITY);
+        getFile(n[0], IO_CLOSE_TE0).close();
+
+        return nil;
+    }
+
+    Value fileExists(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(IO_EXISTS_ARITY);
@@ -112,7 +313,7 @@ namespace Ark::internal::Builtins::IO
         return Ark::Utils::fileExists(n[0].string().c_str()) ? trueSym : falseSym;
     }
 
-    Value listFiles(std::vector<Value>& n, Ark::VM* vm)
+    Value listFiles(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(IO_LS_ARITY);
@@ -126,7 +327,7 @@ namespace Ark::internal::Builtins::IO
         return Value(std::move(r));
     }
 
-    Value isDirectory(std::vector<Value>& n, Ark::VM* vm)
+    Value isDirectory(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(IO_ISDIR_ARITY);
@@ -136,7 +337,7 @@ namespace Ark::internal::Builtins::IO
         return (std::filesystem::is_directory(std::filesystem::path(n[0].string().c_str()))) ? trueSym : falseSym;
     }
 
-    Value makeDir(std::vector<Value>& n, Ark::VM* vm)
+    Value makeDir(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(IO_MKD_ARITY);
@@ -147,12 +348,12 @@ namespace Ark::internal::Builtins::IO
         return nil;
     }
 
-    Value removeFiles(std::vector<Value>& n, Ark::VM* vm)
+    Value removeFiles(ArgsView n, Ark::VM* vm)
     {
         if (n.size() == 0)
             throw std::runtime_error(IO_RM_ARITY);
         
-        for (Value::Iterator it=n.begin(), it_end=n.end(); it != it_end; ++it)
+        for (ArgsView::Iterator it=n.begin(), it_end=n.end(); it != it_end; ++it)
         {
             if (it->valueType() != ValueType::String)
                 throw Ark::TypeError(IO_RM_TE0);
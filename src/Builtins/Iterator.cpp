@@ -0,0 +1,93 @@
+#include <Ark/Builtins/Builtins.hpp>
+
+#include <cmath>
+
+#include <Ark/Builtins/BuiltinsErrors.inl>
+#include <Ark/VM/VM.hpp>
+#include <Ark/VM/Range.hpp>
+
+namespace Ark::internal::Builtins::Iterator
+{
+    Value range(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 2 && n.size() != 3)
+            throw std::runtime_error(ITER_RANGE_ARITY);
+        for (const Value& value : n)
+        {
+            if (value.valueType() != ValueType::Number || !std::isfinite(value.number()))
+                throw Ark::TypeError(ITER_RANGE_TE);
+        }
+
+        double step = n.size() == 3 ? n[2].number() : 1.0;
+        if (step == 0)
+            throw std::runtime_error(ITER_RANGE_STEP);
+        if (Range::count(n[0].number(), n[1].number(), step) > static_cast<double>(Range::MaxSize))
+            throw std::runtime_error(ITER_RANGE_SIZE);
+
+        return Value(std::make_shared<Range>(n[0].number(), n[1].number(), step));
+    }
+
+    Value next(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(ITER_NEXT_ARITY);
+        if (n[0].valueType() != ValueType::Range)
+            throw Ark::TypeError(ITER_NEXT_TE0);
+        if (n[0].isConst())
+            throw std::runtime_error(ITER_NEXT_CONST);
+
+        Range& r = n[0].range();
+        if (r.done())
+            return nil;
+        return Value(r.next());
+    }
+
+    Value done(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(ITER_DONE_ARITY);
+        if (n[0].valueType() != ValueType::Range)
+            throw Ark::TypeError(ITER_DONE_TE0);
+
+        return n[0].const_range().done() ? trueSym : falseSym;
+    }
+
+    Value reset(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(ITER_RESET_ARITY);
+        if (n[0].valueType() != ValueType::Range)
+            throw Ark::TypeError(ITER_RESET_TE0);
+        if (n[0].isConst())
+            throw std::runtime_error(ITER_RESET_CONST);
+
+        n[0].range().reset();
+        return nil;
+    }
+
+    Value toList(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(ITER_TOLIST_ARITY);
+        if (n[0].valueType() != ValueType::Range)
+            throw Ark::TypeError(ITER_TOLIST_TE0);
+
+        const Range& r = n[0].const_range();
+        std::vector<Value> output;
+        output.reserve(r.size());
+        for (std::size_t i = 0, size = r.size(); i < size; ++i)
+            output.emplace_back(r.at(i));
+
+        return Value(std::move(output));
+    }
+
+    Value copy(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(ITER_COPY_ARITY);
+        if (n[0].valueType() != ValueType::Range)
+            throw Ark::TypeError(ITER_COPY_TE0);
+
+        return Value(std::make_shared<Range>(n[0].const_range()));
+    }
+}
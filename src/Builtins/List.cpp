@@ -2,13 +2,205 @@
 
 #include <iterator>
 #include <algorithm>
+#include <string_view>
+#include <cstring>
 
 #include <Ark/Builtins/BuiltinsErrors.inl>
 #include <Ark/VM/VM.hpp>
+#include <Ark/VM/ThreadPool.hpp>
+#include <Ark/VM/Range.hpp>
 
 namespace Ark::internal::Builtins::List
 {
-    Value reverseList(std::vector<Value>& n, Ark::VM* vm)
+    namespace
+    {
+        // the parallel builtins accept a List or a Range, whose numbers are computed when needed
+        inline bool isSequence(const Value& value) noexcept
+        {
+            return value.valueType() == ValueType::List || value.valueType() == ValueType::Range;
+        }
+
+        inline std::size_t sequenceSize(const Value& sequence)
+        {
+            if (sequence.valueType() == ValueType::Range)
+                return sequence.const_range().size();
+            return sequence.listSize();
+        }
+
+        inline Value sequenceAt(const Value& sequence, std::size_t i)
+        {
+            if (sequence.valueType() == ValueType::Range)
+                return Value(sequence.const_range().at(i));
+            return sequence.listData()[i];
+        }
+
+        // the dictionaries, ranges and closures are shared by the copies of a value
+        bool holdsSharedValues(const Value& value)
+        {
+            switch (value.valueType())
+            {
+                case ValueType::Dict:
+                case ValueType::Range:
+                case ValueType::Closure:
+                    return true;
+
+                case ValueType::List:
+                    return std::any_of(value.listData(), value.listData() + value.listSize(), holdsSharedValues);
+
+                default:
+                    return false;
+            }
+        }
+
+        /**
+         * @brief The part of a list given to a thread of the pool, with everything it needs to call the function
+         * 
+         */
+        struct Chunk
+        {
+            std::unique_ptr<Ark::VM> vm;    ///< copy of the calling VM
+            Value function;                 ///< copy of the function for this VM, see VM::isolate
+            std::vector<Value> elements;    ///< copies of the elements for this VM, when the list holds shared values
+            std::size_t begin;
+            std::size_t end;
+
+            inline Value at(const Value& sequence, std::size_t i) const
+            {
+                return elements.empty() ? sequenceAt(sequence, i) : elements[i - begin];
+            }
+        };
+
+        /**
+         * @brief Split the indices of a list in one chunk per thread of the pool, and run a task on each chunk
+         * @details The copies of the VM, of the function and of the elements holding dictionaries, ranges or closures are
+         *          made on the calling thread, before starting the workers: they don't share anything the function could modify.
+         *          The copies of the VM share the scopes of the calling one, without copying its variables: the function must
+         *          be pure, the variables it reads outside of its arguments are read concurrently by the workers.
+         * 
+         * @tparam F 
+         * @param sequence a List or a Range
+         * @param vm the VM to copy
+         * @param function 
+         * @param task called with the chunk and its index
+         */
+        template <typename F>
+        void forEachChunk(const Value& sequence, Ark::VM* vm, const Value& function, F&& task)
+        {
+            ThreadPool& pool = ThreadPool::global();
+            const std::size_t size = sequenceSize(sequence);
+            const std::size_t count = std::min(size, pool.concurrency());
+            const bool isolate = sequence.valueType() == ValueType::List && holdsSharedValues(sequence);
+
+            // the copies of the VM buffer their own output: what this one printed before comes first
+            vm->flush();
+
+            std::vector<Chunk> chunks(count);
+            for (std::size_t c = 0; c < count; ++c)
+            {
+                Chunk& chunk = chunks[c];
+                chunk.vm = vm->fork();
+                chunk.function = chunk.vm->isolate(function);
+                chunk.begin = size * c / count;
+                chunk.end = size * (c + 1) / count;
+                if (isolate)
+                {
+                    chunk.elements.reserve(chunk.end - chunk.begin);
+                    for (std::size_t i = chunk.begin; i < chunk.end; ++i)
+                        chunk.elements.push_back(chunk.vm->isolate(sequenceAt(sequence, i)));
+                }
+            }
+
+            pool.run(count, [&](std::size_t c) {
+                task(chunks[c], c);
+            });
+
+            for (Chunk& chunk : chunks)
+                chunk.vm->flush();
+        }
+
+        // map the doubles to integers sorted in the same order: the sign bit is flipped for the positive numbers, all the bits for the negative ones
+        inline uint64_t toRadixKey(double d) noexcept
+        {
+            uint64_t bits;
+            std::memcpy(&bits, &d, sizeof(bits));
+            return (bits >> 63) ? ~bits : (bits | (1ull << 63));
+        }
+
+        inline double fromRadixKey(uint64_t key) noexcept
+        {
+            uint64_t bits = (key >> 63) ? (key & ~(1ull << 63)) : ~key;
+            double d;
+            std::memcpy(&d, &bits, sizeof(d));
+            return d;
+        }
+
+        /**
+         * @brief Sort numbers with a LSD radix sort on their bytes, skipping the bytes which are the same for all of them
+         * 
+         * @param values 
+         */
+        void radixSort(std::vector<double>& values)
+        {
+            // the radix sort only pays off when there are enough values to fill the buckets
+            if (values.size() < 256)
+            {
+                std::sort(values.begin(), values.end());
+                return;
+            }
+
+            std::vector<uint64_t> keys(values.size());
+            std::vector<uint64_t> sorted(values.size());
+            for (std::size_t i = 0, size = values.size(); i < size; ++i)
+                keys[i] = toRadixKey(values[i]);
+
+            for (unsigned shift = 0; shift < 64; shift += 8)
+            {
+                std::size_t offsets[256] = { 0 };
+                for (uint64_t key : keys)
+                    ++offsets[(key >> shift) & 0xff];
+                // every key has the same byte, nothing to do (eg the high bytes of small integers)
+                if (offsets[(keys[0] >> shift) & 0xff] == keys.size())
+                    continue;
+
+                std::size_t total = 0;
+                for (std::size_t& offset : offsets)
+                {
+                    std::size_t count = offset;
+                    offset = total;
+                    total += count;
+                }
+                for (uint64_t key : keys)
+                    sorted[offsets[(key >> shift) & 0xff]++] = key;
+                keys.swap(sorted);
+            }
+
+            for (std::size_t i = 0, size = values.size(); i < size; ++i)
+                values[i] = fromRadixKey(keys[i]);
+        }
+
+        // put the elements of a list in the order given by a list of indices
+        void reorder(std::vector<Value>& list, const std::vector<std::size_t>& order)
+        {
+            std::vector<Value> output;
+            output.reserve(list.size());
+            for (std::size_t i : order)
+                output.push_back(std::move(list[i]));
+            list.swap(output);
+        }
+
+        // put the elements of a list in the order given by the indices of sorted (key, index) pairs
+        template <typename Key>
+        void reorder(std::vector<Value>& list, const std::vector<std::pair<Key, std::size_t>>& pairs)
+        {
+            std::vector<Value> output;
+            output.reserve(list.size());
+            for (const auto& [key, i] : pairs)
+                output.push_back(std::move(list[i]));
+            list.swap(output);
+        }
+    }
+
+    Value reverseList(ArgsView n, Ark::VM* vm)
     {
         if (n[0].valueType() != ValueType::List)
             throw Ark::TypeError(LIST_REVERSE_ARITY);
@@ -17,27 +209,28 @@ namespace Ark::internal::Builtins::List
 
         std::reverse(n[0].list().begin(), n[0].list().end());
 
-        return n[0];
+        // the arguments are dropped from the stack after the call, the list can be moved instead of copied
+        return std::move(n[0]);
     }
 
-    Value findInList(std::vector<Value>& n, Ark::VM* vm)
+    Value findInList(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 2)
             throw std::runtime_error(LIST_FIND_ARITY);
         if (n[0].valueType() != ValueType::List)
             throw Ark::TypeError(LIST_FIND_TE0);
 
-        std::vector<Value>& l = n[0].list();
-        for (Value::Iterator it=l.begin(), it_end=l.end(); it != it_end; ++it)
+        const Value* l = n[0].listData();
+        for (std::size_t i = 0, size = n[0].listSize(); i < size; ++i)
         {
-            if (*it == n[1])
-                return Value(static_cast<int>(std::distance<Value::Iterator>(l.begin(), it)));
+            if (l[i] == n[1])
+                return Value(static_cast<int>(i));
         }
 
         return Value(-1);
     }
 
-    Value removeAtList(std::vector<Value>& n, Ark::VM* vm)
+    Value removeAtList(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 2)
             throw std::runtime_error(LIST_RMAT_ARITY);
@@ -51,10 +244,10 @@ namespace Ark::internal::Builtins::List
             throw std::runtime_error(LIST_RMAT_OOR);
 
         n[0].list().erase(n[0].list().begin () + idx);
-        return n[0];
+        return std::move(n[0]);
     }
 
-    Value sliceList(std::vector<Value>& n, Ark::VM* vm)
+    Value sliceList(ArgsView n, Ark::VM* vm)
     {
         if (n.size () != 4)
             throw std::runtime_error(LIST_SLICE_ARITY);
@@ -76,28 +269,107 @@ namespace Ark::internal::Builtins::List
 
         if (start > end)
             throw std::runtime_error(LIST_SLICE_ORDER);
-        if (start < 0 || end > n[0].list().size())
+        if (start < 0 || end > n[0].listSize())
             throw std::runtime_error(LIST_SLICE_OOR);
 
+        const Value* l = n[0].listData();
         std::vector<Value> retlist;
         for (std::size_t i=start; i < end; i += step)
-            retlist.push_back(n[0].list()[i]);
+            retlist.push_back(l[i]);
 
         return Value(std::move(retlist));
     }
 
-    Value sort_(std::vector<Value>& n, Ark::VM* vm)
+    Value sort_(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(LIST_SORT_ARITY);
         if (n[0].valueType() != ValueType::List)
             throw Ark::TypeError(LIST_SORT_TE0);
 
-        std::sort(n[0].list().begin(), n[0].list().end());
-        return n[0];
+        std::vector<Value>& list = n[0].list();
+        auto has_type = [&list](ValueType type) {
+            return std::all_of(list.begin(), list.end(), [type](const Value& value) {
+                return value.valueType() == type;
+            });
+        };
+
+        // sort the numbers or the strings without going through the Values
+        if (!list.empty() && has_type(ValueType::Number))
+        {
+            std::vector<double> numbers;
+            numbers.reserve(list.size());
+            for (const Value& value : list)
+                numbers.push_back(value.number());
+
+            radixSort(numbers);
+            for (std::size_t i = 0, size = list.size(); i < size; ++i)
+                list[i] = Value(numbers[i]);
+        }
+        else if (!list.empty() && has_type(ValueType::String))
+        {
+            std::vector<std::pair<std::string_view, std::size_t>> strings;
+            strings.reserve(list.size());
+            for (std::size_t i = 0, size = list.size(); i < size; ++i)
+                strings.emplace_back(std::string_view(list[i].string().c_str(), list[i].string().size()), i);
+
+            std::sort(strings.begin(), strings.end());
+            std::vector<std::size_t> order;
+            order.reserve(strings.size());
+            for (const auto& [str, i] : strings)
+                order.push_back(i);
+            reorder(list, order);
+        }
+        else
+            std::sort(list.begin(), list.end());
+
+        return std::move(n[0]);
     }
 
-    Value fill(std::vector<Value>& n, Ark::VM* vm)
+    Value sortBy(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 2)
+            throw std::runtime_error(LIST_SORTBY_ARITY);
+        if (n[0].valueType() != ValueType::List)
+            throw Ark::TypeError(LIST_SORTBY_TE0);
+        if (!n[1].isFunction())
+            throw Ark::TypeError(LIST_SORTBY_TE1);
+
+        // the function is called on this VM, whose stack can be reallocated: nothing is read from the view afterward
+        Value list = std::move(n[0]);
+        const Value function = n[1];
+        std::vector<Value>& elements = list.list();
+
+        // compute the key of each element once
+        std::vector<Value> keys;
+        keys.reserve(elements.size());
+        for (const Value& value : elements)
+            keys.push_back(vm->resolve(&function, value));
+
+        // the elements with the same key stay in the same order thanks to their index
+        if (std::all_of(keys.begin(), keys.end(), [](const Value& key) { return key.valueType() == ValueType::Number; }))
+        {
+            std::vector<std::pair<double, std::size_t>> pairs;
+            pairs.reserve(keys.size());
+            for (std::size_t i = 0, size = keys.size(); i < size; ++i)
+                pairs.emplace_back(keys[i].number(), i);
+            std::sort(pairs.begin(), pairs.end());
+            reorder(elements, pairs);
+        }
+        else
+        {
+            std::vector<std::pair<Value, std::size_t>> pairs;
+            pairs.reserve(keys.size());
+            for (std::size_t i = 0, size = keys.size(); i < size; ++i)
+                pairs.emplace_back(std::move(keys[i]), i);
+            std::sort(pairs.begin(), pairs.end());
+            reorder(elements, pairs);
+        }
+
+        return list;
+    }
+
+    Value fill(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 2)
             throw std::runtime_error(LIST_FILL_ARITY);
@@ -112,7 +384,7 @@ namespace Ark::internal::Builtins::List
         return Value(std::move(l));
     }
 
-    Value setListAt(std::vector<Value>& n, Ark::VM* vm)
+    Value setListAt(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 3)
             throw std::runtime_error(LIST_SETAT_ARITY);
@@ -122,6 +394,88 @@ namespace Ark::internal::Builtins::List
             throw Ark::TypeError(LIST_SETAT_TE1);
 
         n[0].list()[static_cast<std::size_t>(n[1].number())] = n[2];
-        return n[0];
+        return std::move(n[0]);
+    }
+
+    Value parallelMap(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 2)
+            throw std::runtime_error(LIST_PMAP_ARITY);
+        if (!isSequence(n[0]))
+            throw Ark::TypeError(LIST_PMAP_TE0);
+        if (!n[1].isFunction())
+            throw Ark::TypeError(LIST_PMAP_TE1);
+
+        const Value& list = n[0];
+        // each chunk writes its own results
+        std::vector<Value> output(sequenceSize(list));
+
+        forEachChunk(list, vm, n[1], [&](const Chunk& chunk, std::size_t) {
+            for (std::size_t i = chunk.begin; i < chunk.end; ++i)
+                output[i] = chunk.vm->resolve(&chunk.function, chunk.at(list, i));
+        });
+
+        return Value(std::move(output));
+    }
+
+    Value parallelFilter(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 2)
+            throw std::runtime_error(LIST_PFILTER_ARITY);
+        if (!isSequence(n[0]))
+            throw Ark::TypeError(LIST_PFILTER_TE0);
+        if (!n[1].isFunction())
+            throw Ark::TypeError(LIST_PFILTER_TE1);
+
+        const Value& list = n[0];
+        std::vector<char> keep(sequenceSize(list), 0);
+
+        forEachChunk(list, vm, n[1], [&](const Chunk& chunk, std::size_t) {
+            for (std::size_t i = chunk.begin; i < chunk.end; ++i)
+                keep[i] = !!chunk.vm->resolve(&chunk.function, chunk.at(list, i));
+        });
+
+        std::vector<Value> output;
+        output.reserve(std::count(keep.begin(), keep.end(), 1));
+        for (std::size_t i = 0, size = keep.size(); i < size; ++i)
+        {
+            if (keep[i])
+                output.push_back(sequenceAt(list, i));
+        }
+
+        return Value(std::move(output));
+    }
+
+    Value parallelReduce(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 2)
+            throw std::runtime_error(LIST_PREDUCE_ARITY);
+        if (!isSequence(n[0]))
+            throw Ark::TypeError(LIST_PREDUCE_TE0);
+        if (!n[1].isFunction())
+            throw Ark::TypeError(LIST_PREDUCE_TE1);
+        if (sequenceSize(n[0]) == 0)
+            throw std::runtime_error(LIST_PREDUCE_EMPTY);
+
+        const Value& list = n[0];
+        // the results of the chunks are reduced on this VM, whose stack can be reallocated: nothing is read from the view then
+        const Value function = n[1];
+
+        // reduce each chunk, then the results of the chunks, in order: the function must be associative
+        auto reduce = [](Ark::VM& worker, const Value& function, auto&& at, std::size_t begin, std::size_t end) {
+            Value accumulator = at(begin);
+            for (std::size_t i = begin + 1; i < end; ++i)
+                accumulator = worker.resolve(&function, accumulator, at(i));
+            return accumulator;
+        };
+
+        std::vector<Value> partials(std::min(sequenceSize(list), ThreadPool::global().concurrency()));
+        forEachChunk(list, vm, function, [&](const Chunk& chunk, std::size_t c) {
+            partials[c] = reduce(*chunk.vm, chunk.function, [&](std::size_t i) { return chunk.at(list, i); }, chunk.begin, chunk.end);
+        });
+
+        if (partials.size() == 1)
+            return partials[0];
+        return reduce(*vm, function, [&partials](std::size_t i) { return partials[i]; }, 0, partials.size());
     }
 }
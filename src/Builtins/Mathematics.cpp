@@ -8,7 +8,7 @@
 
 namespace Ark::internal::Builtins::Mathematics
 {
-    Value exponential(std::vector<Value>& n, Ark::VM* vm)
+    Value exponential(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(MATH_ARITY("math:exp"));
@@ -19,7 +19,7 @@ namespace Ark::internal::Builtins::Mathematics
         return r;
     }
 
-    Value logarithm(std::vector<Value>& n, Ark::VM* vm)
+    Value logarithm(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(MATH_ARITY("math:log"));
@@ -32,7 +32,7 @@ namespace Ark::internal::Builtins::Mathematics
         return r;
     }
 
-    Value ceil_(std::vector<Value>& n, Ark::VM* vm)
+    Value ceil_(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(MATH_ARITY("math:ceil"));
@@ -43,7 +43,7 @@ namespace Ark::internal::Builtins::Mathematics
         return r;
     }
 
-    Value floor_(std::vector<Value>& n, Ark::VM* vm)
+    Value floor_(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(MATH_ARITY("math:floor"));
@@ -54,7 +54,7 @@ namespace Ark::internal::Builtins::Mathematics
         return r;
     }
 
-    Value round_(std::vector<Value>& n, Ark::VM* vm)
+    Value round_(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(MATH_ARITY("math:round"));
@@ -65,7 +65,7 @@ namespace Ark::internal::Builtins::Mathematics
         return r;
     }
 
-    Value isnan_(std::vector<Value>& n, Ark::VM* vm)
+    Value isnan_(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(MATH_ARITY("math:NaN?"));
@@ -75,7 +75,7 @@ namespace Ark::internal::Builtins::Mathematics
         return std::isnan(n[0].number()) ? trueSym : falseSym;
     }
 
-    Value isinf_(std::vector<Value>& n, Ark::VM* vm)
+    Value isinf_(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(MATH_ARITY("math:Inf?"));
@@ -85,7 +85,7 @@ namespace Ark::internal::Builtins::Mathematics
         return std::isinf(n[0].number()) ? trueSym : falseSym;
     }
 
-    Value cos_(std::vector<Value>& n, Ark::VM* vm)
+    Value cos_(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(MATH_ARITY("math:cos"));
@@ -96,7 +96,7 @@ namespace Ark::internal::Builtins::Mathematics
         return r;
     }
 
-    Value sin_(std::vector<Value>& n, Ark::VM* vm)
+    Value sin_(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(MATH_ARITY("math:sin"));
@@ -107,7 +107,7 @@ namespace Ark::internal::Builtins::Mathematics
         return r;
     }
 
-    Value tan_(std::vector<Value>& n, Ark::VM* vm)
+    Value tan_(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(MATH_ARITY("math:tan"));
@@ -118,7 +118,7 @@ namespace Ark::internal::Builtins::Mathematics
         return r;
     }
 
-    Value acos_(std::vector<Value>& n, Ark::VM* vm)
+    Value acos_(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(MATH_ARITY("math:arccos"));
@@ -129,7 +129,7 @@ namespace Ark::internal::Builtins::Mathematics
         return r;
     }
 
-    Value asin_(std::vector<Value>& n, Ark::VM* vm)
+    Value asin_(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(MATH_ARITY("math:arcsin"));
@@ -140,7 +140,7 @@ namespace Ark::internal::Builtins::Mathematics
         return r;
     }
 
-    Value atan_(std::vector<Value>& n, Ark::VM* vm)
+    Value atan_(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(MATH_ARITY("math:arctan"));
@@ -1,5 +1,7 @@
 #include <Ark/Builtins/Builtins.hpp>
 
+#include <string_view>
+
 #include <Ark/String.hpp>
 #include <Ark/Utils.hpp>
 
@@ -8,45 +10,34 @@
 
 namespace Ark::internal::Builtins::String
 {
-    Value format(std::vector<Value>& n, Ark::VM* vm)
+    Value format(ArgsView n, Ark::VM* vm)
     {
         if (n.size() == 0)
             throw std::runtime_error(STR_FORMAT_ARITY);
         if (n[0].valueType() != ValueType::String)
             throw Ark::TypeError(STR_FORMAT_TE0);
 
-        ::String f(n[0].string().c_str());
-
-        for (Value::Iterator it=n.begin()+1, it_end=n.end(); it != it_end; ++it)
+        // single pass on the format string: each %% is replaced by the next value, written in the same stream,
+        // and the %% left when there are no more values are kept as is
+        std::string_view f(n[0].string().c_str(), n[0].string().size());
+        std::ostringstream output;
+        std::size_t start = 0;
+        for (ArgsView::Iterator it=n.begin()+1, it_end=n.end(); it != it_end; ++it)
         {
-            if (it->valueType() == ValueType::String)
-            {
-                ::String& obj = it->string_ref();
-                f.format(f.size() + obj.size(), obj.c_str());
-            }
-            else if (it->valueType() == ValueType::Number)
-            {
-                // TODO handle doubles
-                long obj = it->number();
-                f.format(f.size() + Utils::dig_places(obj) + Utils::dec_places(obj), obj);
-            }
-            else if (it->valueType() == ValueType::Nil)
-                f.format(f.size() + 5, std::string_view("nil"));
-            else if (it->valueType() == ValueType::True)
-                f.format(f.size() + 5, std::string_view("true"));
-            else if (it->valueType() == ValueType::False)
-                f.format(f.size() + 5, std::string_view("false"));
-            else
-            {
-                std::stringstream ss; ss << (*it);
-                f.format(f.size() + ss.str().size(), std::string_view(ss.str().c_str()));
-            }
+            std::size_t pos = f.find("%%", start);
+            if (pos == std::string_view::npos)
+                break;
+
+            output.write(f.data() + start, pos - start);
+            output << (*it);
+            start = pos + 2;
         }
-        n[0].string_ref() = f;
-        return n[0];
+        output.write(f.data() + start, f.size() - start);
+
+        return Value(output.str());
     }
 
-    Value findSubStr(std::vector<Value>& n, Ark::VM* vm)
+    Value findSubStr(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 2)
             throw std::runtime_error(STR_FIND_ARITY);
@@ -58,7 +49,7 @@ namespace Ark::internal::Builtins::String
         return Value(n[0].string_ref().find(n[1].string_ref()));
     }
 
-    Value removeAtStr(std::vector<Value>& n, Ark::VM* vm)
+    Value removeAtStr(ArgsView n, Ark::VM* vm)
     {
         if (n.size () != 2)
             throw std::runtime_error(STR_RM_ARITY);
@@ -74,4 +65,39 @@ namespace Ark::internal::Builtins::String
         n[0].string_ref().erase(id, id + 1);
         return n[0];
     }
+
+    Value builder(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 0)
+            throw std::runtime_error(STR_BUILDER_ARITY);
+
+        // the pieces are added by str:append!, which is compiled to in place appends to the list
+        return Value(ValueType::List);
+    }
+
+    Value build(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 1)
+            throw std::runtime_error(STR_BUILD_ARITY);
+        if (n[0].valueType() != ValueType::List)
+            throw Ark::TypeError(STR_BUILD_TE0);
+
+        const Value* pieces = n[0].listData();
+        const std::size_t count = n[0].listSize();
+
+        std::size_t size = 0;
+        for (const Value* piece = pieces; piece != pieces + count; ++piece)
+        {
+            if (piece->valueType() != ValueType::String)
+                throw Ark::TypeError(STR_BUILD_TE0);
+            size += piece->string().size();
+        }
+
+        std::string output;
+        output.reserve(size);
+        for (const Value* piece = pieces; piece != pieces + count; ++piece)
+            output.append(piece->string().c_str(), piece->string().size());
+
+        return Value(output);
+    }
 }
@@ -13,7 +13,7 @@
 
 namespace Ark::internal::Builtins::System
 {
-    Value system_(std::vector<Value>& n, Ark::VM* vm)
+    Value system_(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(SYS_SYS_ARITY);
@@ -28,7 +28,7 @@ namespace Ark::internal::Builtins::System
         return nil;
     }
 
-    Value sleep(std::vector<Value>& n, Ark::VM* vm)
+    Value sleep(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(SYS_SLEEP_ARITY);
@@ -41,7 +41,7 @@ namespace Ark::internal::Builtins::System
         return nil;
     }
 
-    Value exit_(std::vector<Value>& n, Ark::VM* vm)
+    Value exit_(ArgsView n, Ark::VM* vm)
     {
         if (n.size() != 1)
             throw std::runtime_error(SYS_EXIT_ARITY);
@@ -52,4 +52,46 @@ namespace Ark::internal::Builtins::System
 
         return nil;
     }
+
+    Value memory(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() > 1)
+            throw std::runtime_error(SYS_MEMORY_ARITY);
+
+        auto fields = vm->memoryStats().fields();
+
+        // a single statistic
+        if (n.size() == 1)
+        {
+            if (n[0].valueType() != ValueType::String)
+                throw Ark::TypeError(SYS_MEMORY_TE0);
+
+            std::string name = n[0].string().c_str();
+            for (auto&& [field, value] : fields)
+            {
+                if (field == name)
+                    return Value(static_cast<double>(value));
+            }
+            throw std::runtime_error(SYS_MEMORY_UNKNOWN + name);
+        }
+
+        // all the statistics, as a list of [name value]
+        Value output(ValueType::List);
+        for (auto&& [field, value] : fields)
+        {
+            Value pair(ValueType::List);
+            pair.push_back(Value(field));
+            pair.push_back(Value(static_cast<double>(value)));
+            output.push_back(pair);
+        }
+        return output;
+    }
+
+    Value gc(ArgsView n, Ark::VM* vm)
+    {
+        if (n.size() != 0)
+            throw std::runtime_error(SYS_GC_ARITY);
+
+        return Value(static_cast<double>(vm->collectGarbage()));
+    }
 }
\ No newline at end of file
@@ -8,7 +8,7 @@
 
 namespace Ark::internal::Builtins::Time
 {
-    Value timeSinceEpoch(std::vector<Value>& n, Ark::VM* vm)
+    Value timeSinceEpoch(ArgsView n, Ark::VM* vm)
     {
         const auto now = std::chrono::system_clock::now();
         const auto epoch = now.time_since_epoch();
@@ -18,15 +18,11 @@ namespace Ark
         if (!ifs.good())
             throw std::runtime_error("[BytecodeReader] Couldn't open file '" + file + "'");
         std::size_t pos = ifs.tellg();
-        // reserve appropriate number of bytes
-        std::vector<char> temp(pos);
+        // read the file at once, directly in the bytecode
+        m_bytecode = bytecode_t(pos);
         ifs.seekg(0, std::ios::beg);
-        ifs.read(&temp[0], pos);
+        ifs.read(reinterpret_cast<char*>(m_bytecode.data()), static_cast<std::streamsize>(pos));
         ifs.close();
-
-        m_bytecode = bytecode_t(pos);
-        for (std::size_t i=0; i < pos; ++i)
-            m_bytecode[i] = static_cast<uint8_t>(temp[i]);
     }
 
     const bytecode_t& BytecodeReader::bytecode() noexcept
@@ -36,7 +32,7 @@ namespace Ark
 
     unsigned long long BytecodeReader::timestamp()
     {
-        bytecode_t b = bytecode();
+        const bytecode_t& b = bytecode();
         std::size_t i = 0;
 
         // we want to see a 'ark\0' header
@@ -66,7 +62,7 @@ namespace Ark
 
     void BytecodeReader::display()
     {
-        bytecode_t b = bytecode();
+        const bytecode_t& b = bytecode();
         std::size_t i = 0;
 
         std::ostream& os = std::cout;
@@ -294,6 +290,26 @@ namespace Ark
                         os << "CONCAT " << termcolor::reset << "(" << readNumber(i) << ")\n";
                         i++;
                     }
+                    else if (inst == Instruction::APPEND_IN_PLACE)
+                    {
+                        os << "APPEND_IN_PLACE " << termcolor::green << symbols[readNumber(i)] << "\n";
+                        i++;
+                    }
+                    else if (inst == Instruction::CONCAT_IN_PLACE)
+                    {
+                        os << "CONCAT_IN_PLACE " << termcolor::green << symbols[readNumber(i)] << "\n";
+                        i++;
+                    }
+                    else if (inst == Instruction::SET_AT_IN_PLACE)
+                    {
+                        os << "SET_AT_IN_PLACE " << termcolor::green << symbols[readNumber(i)] << "\n";
+                        i++;
+                    }
+                    else if (inst == Instruction::ERASE_IN_PLACE)
+                    {
+                        os << "ERASE_IN_PLACE " << termcolor::green << symbols[readNumber(i)] << "\n";
+                        i++;
+                    }
                     else if (inst == Instruction::ADD)
                         os << "ADD\n";
                     else if (inst == Instruction::SUB)
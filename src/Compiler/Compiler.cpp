@@ -12,7 +12,7 @@ namespace Ark
     using namespace Ark::internal;
 
     Compiler::Compiler(unsigned debug, const std::string& lib_dir, uint16_t options) :
-        m_parser(debug, lib_dir, options), m_optimizer(options),
+        m_parser(debug, lib_dir, options), m_optimizer(options, m_parser.sources()),
         m_options(options), m_debug(debug)
     {}
 
@@ -191,6 +191,40 @@ namespace Ark
         }
     }
 
+    std::size_t Compiler::compileIncremental()
+    {
+        // save the tables sizes to be able to roll back if the compilation fails
+        const std::size_t symbols_count = m_symbols.size(),
+                          defined_count = m_defined_symbols.size(),
+                          plugins_count = m_plugins.size(),
+                          values_count = m_values.size(),
+                          pages_count = m_code_pages.size();
+
+        try
+        {
+            m_code_pages.emplace_back();
+            std::size_t entry_page = m_code_pages.size() - 1;
+            _compile(m_optimizer.ast(), static_cast<int>(entry_page));
+            checkForUndefinedSymbol();
+
+            // same as in compile(), a HALT at the end of every page to avoid going too far
+            for (std::size_t i=entry_page, end=m_code_pages.size(); i < end; ++i)
+                m_code_pages[i].push_back(Instruction::HALT);
+
+            return entry_page;
+        }
+        catch (...)
+        {
+            m_symbols.erase(m_symbols.begin() + symbols_count, m_symbols.end());
+            m_defined_symbols.erase(m_defined_symbols.begin() + defined_count, m_defined_symbols.end());
+            m_plugins.erase(m_plugins.begin() + plugins_count, m_plugins.end());
+            m_values.erase(m_values.begin() + values_count, m_values.end());
+            m_code_pages.erase(m_code_pages.begin() + pages_count, m_code_pages.end());
+            m_temp_pages.clear();
+            throw;
+        }
+    }
+
     void Compiler::saveTo(const std::string& file)
     {
         if (m_debug >= 1)
@@ -292,6 +326,49 @@ namespace Ark
                 pushNumber(argc - 1, &page(p));
             return;
         }
+        // in place list modifications, working directly on the variable given as the first argument
+        else if (auto c0 = x.const_list()[0]; c0.nodeType() == NodeType::Symbol && (c0.string() == "append!" || c0.string() == "concat!" || c0.string() == "list:setAt!" || c0.string() == "list:removeAt!" || c0.string() == "str:append!"))
+        {
+            std::string name = c0.string();
+            // length of at least 1 since we got a symbol name
+            std::size_t argc = x.const_list().size() - 1;
+
+            if (argc == 0 || x.const_list()[1].nodeType() != NodeType::Symbol)
+                throw Ark::CompilationError(name + " needs a variable name as its first argument");
+            if ((name == "append!" || name == "concat!" || name == "str:append!") && argc < 2)
+                throw Ark::CompilationError("can not use " + name + " with less than 2 arguments");
+            if (name == "list:setAt!" && argc != 3)
+                throw Ark::CompilationError(name + " needs 3 arguments: list, index, value");
+            if (name == "list:removeAt!" && argc != 2)
+                throw Ark::CompilationError(name + " needs 2 arguments: list, index");
+
+            std::size_t i = addSymbol(x.const_list()[1]);
+
+            // compile the other arguments in reverse order, the first one is on top of the stack
+            for (std::size_t j = argc; j > 1; --j)
+            {
+                _compile(x.const_list()[j], p);
+                // a string builder is a list of strings, the values are converted before being appended
+                if (name == "str:append!")
+                    page(p).emplace_back(Instruction::TO_STR);
+            }
+
+            if (name == "append!" || name == "concat!" || name == "str:append!")
+            {
+                // one instruction per value (or list) to add, each one taking it from the stack
+                for (std::size_t j = 1; j < argc; ++j)
+                {
+                    page(p).emplace_back(name == "concat!" ? Instruction::CONCAT_IN_PLACE : Instruction::APPEND_IN_PLACE);
+                    pushNumber(static_cast<uint16_t>(i), &page(p));
+                }
+            }
+            else
+            {
+                page(p).emplace_back(name == "list:setAt!" ? Instruction::SET_AT_IN_PLACE : Instruction::ERASE_IN_PLACE);
+                pushNumber(static_cast<uint16_t>(i), &page(p));
+            }
+            return;
+        }
         // registering structures
         else if (x.const_list()[0].nodeType() == NodeType::Keyword)
         {
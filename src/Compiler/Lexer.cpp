@@ -11,6 +11,9 @@ namespace Ark::internal
 
     void Lexer::feed(const std::string& code)
     {
+        // the lexer can be fed multiple times (eg by the REPL), start from a clean list
+        m_tokens.clear();
+
         std::size_t line = 0, character = 0;
         std::size_t saved_line = 0, saved_char = 0;
         // flags
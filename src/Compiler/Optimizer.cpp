@@ -4,8 +4,8 @@ namespace Ark
 {
     using namespace internal;
 
-    Optimizer::Optimizer(uint16_t options) noexcept :
-        m_options(options)
+    Optimizer::Optimizer(uint16_t options, std::shared_ptr<SourceCache> sources) noexcept :
+        m_options(options), m_sources(std::move(sources))
     {}
 
     void Optimizer::feed(const Node& ast)
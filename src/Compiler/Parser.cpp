@@ -16,7 +16,8 @@ namespace Ark
         m_libdir(lib_dir),
         m_options(options),
         m_lexer(debug),
-        m_file(ARK_NO_NAME_FILE)
+        m_file(ARK_NO_NAME_FILE),
+        m_sources(std::make_shared<SourceCache>())
     {}
 
     void Parser::feed(const std::string& code, const std::string& filename)
@@ -28,6 +29,7 @@ namespace Ark
             if (m_debug >= 2)
                 Ark::logger.data("New parser:", m_file);
             m_parent_include.push_back(m_file);
+            m_sources->add(m_file, code);
         }
 
         m_code = code;
@@ -69,6 +71,11 @@ namespace Ark
         return m_parent_include;
     }
 
+    const std::shared_ptr<SourceCache>& Parser::sources() const noexcept
+    {
+        return m_sources;
+    }
+
     void Parser::sugar(std::vector<Token>& tokens) noexcept
     {
         std::size_t i = 0;
@@ -475,12 +482,13 @@ namespace Ark
                         if (std::find(m_parent_include.begin(), m_parent_include.end(), Ark::Utils::canonicalRelPath(included_file)) == m_parent_include.end())
                         {
                             Parser p(m_debug, m_libdir, m_options);
+                            p.m_sources = m_sources;
                             // feed the new parser with our parent includes
                             for (auto&& pi : m_parent_include)
                                 p.m_parent_include.push_back(Ark::Utils::canonicalRelPath(pi));  // new parser, we can assume that the parent include list is empty
                             p.m_parent_include.push_back(Ark::Utils::canonicalRelPath(m_file));  // add the current file to avoid importing it again
 
-                            p.feed(Ark::Utils::readFile(included_file), included_file);
+                            p.feed(m_sources->read(included_file), included_file);
 
                             // update our list of included files
                             for (auto&& inc : p.m_parent_include)
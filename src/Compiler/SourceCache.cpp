@@ -0,0 +1,22 @@
+#include <Ark/Compiler/SourceCache.hpp>
+
+#include <Ark/Utils.hpp>
+
+namespace Ark::internal
+{
+    const std::string& SourceCache::read(const std::string& filename)
+    {
+        std::string path = Utils::canonicalRelPath(filename);
+        auto it = m_files.find(path);
+        if (it == m_files.end())
+            it = m_files.emplace(path, Utils::readFile(filename)).first;
+        return it->second;
+    }
+
+    void SourceCache::add(const std::string& filename, const std::string& code)
+    {
+        std::string path = Utils::canonicalRelPath(filename);
+        if (m_files.find(path) == m_files.end())
+            m_files.emplace(std::move(path), code);
+    }
+}
@@ -8,7 +8,7 @@
 namespace Ark
 {
     Repl::Repl(uint16_t options, std::string lib_dir) :
-        m_options(options), m_lib_dir(lib_dir), m_lines(1), m_old_ip(0)
+        m_options(options), m_lib_dir(lib_dir), m_lines(1)
     {}
     
     void Repl::run()
@@ -16,19 +16,16 @@ namespace Ark
         Ark::State state(m_options, m_lib_dir);
         Ark::VM vm(&state);
         state.setDebug(0);
-        std::string code;
-        bool init = false;
 
         print_repl_header();
         cgui_setup();
 
         while (true)
         {
-            std::stringstream tmp_code;
+            std::stringstream code;
             unsigned open_parentheses = 0;
             unsigned open_braces = 0;
 
-            tmp_code << code;
             while (true)
             {
                 std::string str_lines = "000";
@@ -51,7 +48,7 @@ namespace Ark
                 if (line == "(quit)")
                     return;
 
-                tmp_code << line << "\n";
+                code << line << "\n";
                 open_parentheses += count_open_parentheses(line);
                 open_braces += count_open_braces(line);
 
@@ -61,34 +58,11 @@ namespace Ark
                     break;
             }
 
-            // save a valid ip if execution failed
-            m_old_ip = vm.m_ip;
-            if (state.doString(tmp_code.str()))
-            {
-                // for only one vm init
-                if (init == false)
-                {
-                    vm.init();
-                    init = true;
-                }
-
-                if (vm.safeRun() == 0)
-                {
-                    // save good code 
-                    code = tmp_code.str();
-                    // place ip to end of bytecode intruction (HALT)
-                    -- vm.m_ip;
-                }
-                else
-                {
-                    // reset ip if execution failed
-                    vm.m_ip = m_old_ip;
-                }
-
-                state.reset();
-            }
+            // only the new code is compiled and run
+            if (state.doStringIncremental(code.str()))
+                vm.runIncremental();
             else
-                std::cerr << "Ark::State::doString failed" << std::endl;
+                std::cerr << "Ark::State::doStringIncremental failed" << std::endl;
         }
     }
 
@@ -1,7 +1,36 @@
 #include <Ark/Utils.hpp>
 
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+
 namespace Ark::Utils
 {
+    std::string readFile(const std::string& name)
+    {
+        std::ifstream f(name.c_str());
+        // admitting the file exists
+        std::string content;
+
+        // read the whole file at once when we know its size
+        std::error_code ec;
+        std::uintmax_t size = std::filesystem::file_size(name, ec);
+        if (!ec && size > 0)
+        {
+            content.resize(static_cast<std::size_t>(size));
+            f.read(content.data(), static_cast<std::streamsize>(size));
+            // less characters are read in text mode when the line endings are converted
+            content.resize(static_cast<std::size_t>(f.gcount()));
+        }
+
+        // files without a size (eg /proc or pipes), or which grew since
+        char buffer[4096];
+        while (f.read(buffer, sizeof(buffer)) || f.gcount() > 0)
+            content.append(buffer, static_cast<std::size_t>(f.gcount()));
+
+        return content;
+    }
+
     int dec_places(double d)
     {
         constexpr double precision = 1e-7;
@@ -29,4 +58,30 @@ namespace Ark::Utils
         }
         return digit_places;
     }
-}
\ No newline at end of file
+
+    std::string_view formatNumber(double d, char* buffer) noexcept
+    {
+        // integers are written in full, the shortest representation of 2000000 being 2e+06
+        if (std::abs(d) < 1e15 && d == std::trunc(d))
+        {
+            auto result = std::to_chars(buffer, buffer + NumberBufferSize, static_cast<long long>(d));
+            return std::string_view(buffer, static_cast<std::size_t>(result.ptr - buffer));
+        }
+
+#ifdef __cpp_lib_to_chars
+        // shortest round trip representation (Ryu in libstdc++ and MSVC)
+        auto result = std::to_chars(buffer, buffer + NumberBufferSize, d);
+        return std::string_view(buffer, static_cast<std::size_t>(result.ptr - buffer));
+#else
+        // without to_chars for floating point numbers, try the precisions until the number reads back the same
+        int size = 0;
+        for (int precision = 15; precision <= 17; ++precision)
+        {
+            size = std::snprintf(buffer, NumberBufferSize, "%.*g", precision, d);
+            if (std::strtod(buffer, nullptr) == d)
+                break;
+        }
+        return std::string_view(buffer, static_cast<std::size_t>(size));
+#endif
+    }
+}
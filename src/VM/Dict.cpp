@@ -0,0 +1,263 @@
+#include <Ark/VM/Dict.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <string_view>
+#include <functional>
+
+namespace Ark::internal
+{
+    Dict::Dict() :
+        m_table(std::make_shared<Table>())
+    {}
+
+    bool Dict::isHashable(const Value& key) noexcept
+    {
+        switch (key.valueType())
+        {
+            case ValueType::Number:
+                // NaN isn't equal to itself, it could never be found again
+                return !std::isnan(key.number());
+
+            case ValueType::String:
+            case ValueType::Nil:
+            case ValueType::True:
+            case ValueType::False:
+                return true;
+
+            default:
+                return false;
+        }
+    }
+
+    const Value* Dict::find(const Value& key) const noexcept
+    {
+        if (m_table->size == 0)
+            return nullptr;
+
+        std::size_t slot = findSlot(key, hash(key));
+        if (slot == m_table->indices.size())
+            return nullptr;
+        return &m_table->entries[m_table->indices[slot]].value;
+    }
+
+    void Dict::set(const Value& key, Value value)
+    {
+        Table& table = this->table();
+        std::size_t h = hash(key);
+        if (table.size != 0)
+        {
+            if (std::size_t slot = findSlot(key, h); slot != table.indices.size())
+            {
+                table.entries[table.indices[slot]].value = std::move(value);
+                return;
+            }
+        }
+
+        // keep the table at most 2/3 full, counting the removed entries still in it
+        if ((table.entries.size() + 1) * 3 > table.indices.size() * 2)
+            rehash(table.size + 1);
+
+        std::size_t mask = table.indices.size() - 1;
+        std::size_t slot = h & mask;
+        while (table.indices[slot] >= 0)
+            slot = (slot + 1) & mask;
+
+        table.indices[slot] = static_cast<int32_t>(table.entries.size());
+        table.entries.push_back(Entry { key, std::move(value), h });
+        ++table.size;
+    }
+
+    bool Dict::remove(const Value& key)
+    {
+        if (m_table->size == 0)
+            return false;
+
+        std::size_t slot = findSlot(key, hash(key));
+        if (slot == m_table->indices.size())
+            return false;
+
+        // the entry stays until the next rehash, to keep the indices of the others
+        Table& table = this->table();
+        Entry& entry = table.entries[table.indices[slot]];
+        entry.key = Value();
+        entry.value = Value();
+        table.indices[slot] = Deleted;
+        --table.size;
+
+        if (table.size == 0)
+        {
+            table.entries.clear();
+            std::fill(table.indices.begin(), table.indices.end(), Empty);
+        }
+        return true;
+    }
+
+    void Dict::clear()
+    {
+        // the other dictionaries sharing the entries keep them
+        if (m_table.use_count() > 1)
+        {
+            m_table = std::make_shared<Table>();
+            return;
+        }
+
+        m_table->entries.clear();
+        std::fill(m_table->indices.begin(), m_table->indices.end(), Empty);
+        m_table->size = 0;
+    }
+
+    std::vector<Value> Dict::keys() const
+    {
+        std::vector<Value> output;
+        output.reserve(m_table->size);
+        forEach([&output](const Value& key, const Value&) {
+            output.push_back(key);
+        });
+        return output;
+    }
+
+    std::vector<Value> Dict::values() const
+    {
+        std::vector<Value> output;
+        output.reserve(m_table->size);
+        forEach([&output](const Value&, const Value& value) {
+            output.push_back(value);
+        });
+        return output;
+    }
+
+    std::size_t Dict::reservedBytes() const noexcept
+    {
+        return sizeof(Table) + m_table->entries.capacity() * sizeof(Entry) + m_table->indices.capacity() * sizeof(int32_t);
+    }
+
+    std::size_t Dict::hash(const Value& key) noexcept
+    {
+        switch (key.valueType())
+        {
+            case ValueType::Number:
+            {
+                double d = key.number();
+                // 0.0 and -0.0 are equal, they must have the same hash
+                return std::hash<double>{}(d == 0.0 ? 0.0 : d);
+            }
+
+            case ValueType::String:
+                return std::hash<std::string_view>{}(std::string_view(key.string().c_str(), key.string().size()));
+
+            default:
+                return static_cast<std::size_t>(key.valueType());
+        }
+    }
+
+    std::size_t Dict::findSlot(const Value& key, std::size_t hash) const noexcept
+    {
+        const std::vector<int32_t>& indices = m_table->indices;
+        std::size_t mask = indices.size() - 1;
+        for (std::size_t slot = hash & mask; ; slot = (slot + 1) & mask)
+        {
+            int32_t index = indices[slot];
+            if (index == Empty)
+                return indices.size();
+            if (index >= 0 && m_table->entries[index].hash == hash && m_table->entries[index].key == key)
+                return slot;
+        }
+    }
+
+    void Dict::rehash(std::size_t capacity)
+    {
+        Table& table = this->table();
+
+        // compact the entries, removing the holes left by remove
+        if (table.size != table.entries.size())
+        {
+            std::size_t j = 0;
+            for (std::size_t i = 0, end = table.entries.size(); i < end; ++i)
+            {
+                if (table.entries[i].key.valueType() != ValueType::Undefined)
+                {
+                    if (i != j)
+                        table.entries[j] = std::move(table.entries[i]);
+                    ++j;
+                }
+            }
+            table.entries.resize(j);
+        }
+
+        std::size_t size = 8;
+        while (capacity * 3 > size * 2)
+            size *= 2;
+
+        table.indices.assign(size, Empty);
+        std::size_t mask = size - 1;
+        for (std::size_t i = 0, end = table.entries.size(); i < end; ++i)
+        {
+            std::size_t slot = table.entries[i].hash & mask;
+            while (table.indices[slot] != Empty)
+                slot = (slot + 1) & mask;
+            table.indices[slot] = static_cast<int32_t>(i);
+        }
+    }
+
+    Dict::Table& Dict::table()
+    {
+        if (m_table.use_count() > 1)
+            m_table = std::make_shared<Table>(*m_table);
+        return *m_table;
+    }
+
+    bool operator==(const Dict& A, const Dict& B) noexcept
+    {
+        if (A.m_table == B.m_table)
+            return true;
+        if (A.m_table->size != B.m_table->size)
+            return false;
+
+        for (const Dict::Entry& entry : A.m_table->entries)
+        {
+            if (entry.key.valueType() == ValueType::Undefined)
+                continue;
+            const Value* other = B.find(entry.key);
+            if (other == nullptr || !(*other == entry.value))
+                return false;
+        }
+        return true;
+    }
+
+    bool isEmpty(const Dict& D) noexcept
+    {
+        return D.size() == 0;
+    }
+
+    std::ostream& operator<<(std::ostream& os, const Dict& D) noexcept
+    {
+        // a dictionary can hold itself, directly or through other dictionaries
+        thread_local std::vector<const Dict*> printing;
+        if (std::find(printing.begin(), printing.end(), &D) != printing.end())
+            return os << "{...}";
+        printing.push_back(&D);
+
+        os << "{";
+        bool first = true;
+        D.forEach([&os, &first](const Value& key, const Value& value) {
+            if (!first)
+                os << ", ";
+            first = false;
+
+            if (key.valueType() == ValueType::String)
+                os << "\"" << key << "\"";
+            else
+                os << key;
+            os << ": ";
+            if (value.valueType() == ValueType::String)
+                os << "\"" << value << "\"";
+            else
+                os << value;
+        });
+        os << "}";
+
+        printing.pop_back();
+        return os;
+    }
+}
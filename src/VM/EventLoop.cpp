@@ -0,0 +1,105 @@
+#include <Ark/VM/EventLoop.hpp>
+
+#include <Ark/Builtins/Builtins.hpp>
+
+namespace Ark::internal
+{
+    EventLoop::EventLoop() noexcept :
+        m_in_flight(0), m_stop(false)
+    {}
+
+    EventLoop::~EventLoop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake_up.notify_all();
+        if (m_worker.joinable())
+            m_worker.join();
+    }
+
+    void EventLoop::addTimer(std::size_t task, Clock::time_point deadline)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_timers.emplace(deadline, task);
+    }
+
+    void EventLoop::submit(std::size_t task, Operation operation)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_operations.emplace_back(task, std::move(operation));
+            ++m_in_flight;
+
+            if (!m_worker.joinable())
+                m_worker = std::thread([this]() {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    while (true)
+                    {
+                        m_wake_up.wait(lock, [this]() { return m_stop || !m_operations.empty(); });
+                        if (m_stop)
+                            return;
+
+                        auto [id, op] = std::move(m_operations.front());
+                        m_operations.pop_front();
+
+                        lock.unlock();
+                        Value result = Builtins::nil;
+                        try {
+                            result = op();
+                        } catch (...) {}
+                        lock.lock();
+
+                        m_completed.emplace_back(id, std::move(result));
+                        --m_in_flight;
+                        m_done.notify_all();
+                    }
+                });
+        }
+        m_wake_up.notify_all();
+    }
+
+    bool EventLoop::pending() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return !m_timers.empty() || m_in_flight != 0 || !m_completed.empty();
+    }
+
+    std::vector<std::pair<std::size_t, Value>> EventLoop::wait()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        while (m_completed.empty() && (!m_timers.empty() || m_in_flight != 0))
+        {
+            if (m_timers.empty())
+            {
+                m_done.wait(lock);
+                continue;
+            }
+
+            // wake up the tasks whose timers expired, all at once
+            auto now = Clock::now();
+            if (m_timers.begin()->first <= now)
+            {
+                auto end = m_timers.upper_bound(now);
+                for (auto it = m_timers.begin(); it != end; ++it)
+                    m_completed.emplace_back(it->second, Builtins::nil);
+                m_timers.erase(m_timers.begin(), end);
+            }
+            else
+                m_done.wait_until(lock, m_timers.begin()->first);
+        }
+
+        std::vector<std::pair<std::size_t, Value>> completed;
+        completed.swap(m_completed);
+        return completed;
+    }
+
+    void EventLoop::clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_timers.clear();
+        m_completed.clear();
+    }
+}
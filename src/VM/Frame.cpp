@@ -12,6 +12,23 @@ namespace Ark::internal
         m_stack(4, Value(ValueType::Undefined)), m_i(0), m_scope_to_delete(0)
     {}
 
+    void Frame::reset() noexcept
+    {
+        m_addr = 0;
+        m_page_addr = 0;
+        m_new_pp = 0;
+        // the popped values are not destroyed by pop(), release them as well
+        for (Value& value : m_stack)
+            value = Value(ValueType::Undefined);
+        m_i = 0;
+        m_scope_to_delete = 0;
+    }
+
+    bool ArgsView::valid() const noexcept
+    {
+        return m_frames == nullptr || (m_frame < m_frames->size() && (*m_frames)[m_frame].m_stack.data() == m_stack_data);
+    }
+
     std::ostream& operator<<(std::ostream& os, const Frame& F) noexcept
     {
         os << "Frame";
@@ -0,0 +1,182 @@
+#include <Ark/VM/GarbageCollector.hpp>
+
+#include <Ark/VM/Dict.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace Ark::internal
+{
+    namespace
+    {
+        template <typename T>
+        std::vector<std::shared_ptr<T>> lockAll(const std::vector<std::weak_ptr<T>>& tracked)
+        {
+            std::vector<std::shared_ptr<T>> output;
+            output.reserve(tracked.size());
+            for (const std::weak_ptr<T>& weak : tracked)
+            {
+                if (std::shared_ptr<T> ptr = weak.lock())
+                    output.push_back(std::move(ptr));
+            }
+            std::sort(output.begin(), output.end());
+            output.erase(std::unique(output.begin(), output.end()), output.end());
+            return output;
+        }
+    }
+
+    template <typename F>
+    void GarbageCollector::forEachReference(const Value& value, F&& function)
+    {
+        if (value.valueType() == ValueType::Closure)
+            function(static_cast<const void*>(value.closure().scope().get()));
+        // the content of a dictionary is visited when it is tracked, otherwise what it holds is kept alive
+        else if (value.valueType() == ValueType::Dict)
+            function(static_cast<const void*>(std::get<std::shared_ptr<Dict>>(value.m_value).get()));
+        else if (value.valueType() == ValueType::List)
+        {
+            // the buffer of a slice holds a single reference per element, whatever the number of slices viewing it:
+            // it isn't visited, like an untracked dictionary, to avoid counting the same references multiple times,
+            // unless a single slice uses it (a list loaded from a variable), which owns it like a vector
+            const std::vector<Value>* elements = std::get_if<std::vector<Value>>(&value.m_value);
+            if (const ListSlice* slice = std::get_if<ListSlice>(&value.m_value); slice != nullptr && slice->buffer.use_count() == 1)
+                elements = slice->buffer.get();
+
+            if (elements != nullptr)
+            {
+                for (const Value& elem : *elements)
+                    forEachReference(elem, function);
+            }
+        }
+    }
+
+    GarbageCollector::GarbageCollector(std::size_t threshold) noexcept :
+        m_threshold(threshold), m_next_collection(threshold)
+    {}
+
+    GarbageCollector::~GarbageCollector()
+    {
+        collect();
+    }
+
+    std::size_t GarbageCollector::collect()
+    {
+        // keep the scopes and the dictionaries still alive (once each) during the collection,
+        // the scopes are the first nodes of the graph, followed by the dictionaries
+        std::vector<Scope_t> scopes = lockAll(m_tracked);
+        std::vector<std::shared_ptr<Dict>> dicts = lockAll(m_tracked_dicts);
+        const std::size_t count = scopes.size() + dicts.size();
+
+        std::unordered_map<const void*, std::size_t> indices;
+        indices.reserve(count);
+        for (std::size_t i = 0, end = scopes.size(); i < end; ++i)
+            indices[scopes[i].get()] = i;
+        for (std::size_t i = 0, end = dicts.size(); i < end; ++i)
+            indices[dicts[i].get()] = scopes.size() + i;
+
+        auto forEachValue = [&](std::size_t node, auto&& function) {
+            if (node < scopes.size())
+            {
+                for (const auto& [id, value] : scopes[node]->m_data)
+                    function(value);
+            }
+            // entries shared by multiple dictionaries hold a single reference per value, whatever the number of dictionaries:
+            // like the buffer of a slice, they aren't visited, what they hold is kept alive
+            else if (const Dict& dict = *dicts[node - scopes.size()]; !dict.sharesEntries())
+                dict.forEach([&function](const Value&, const Value& value) {
+                    function(value);
+                });
+        };
+
+        // references to each node, minus ours, minus the ones from the other tracked nodes
+        std::vector<long> external_refs(count);
+        for (std::size_t i = 0; i < count; ++i)
+            external_refs[i] = (i < scopes.size() ? scopes[i].use_count() : dicts[i - scopes.size()].use_count()) - 1;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            forEachValue(i, [&](const Value& value) {
+                forEachReference(value, [&](const void* target) {
+                    if (auto it = indices.find(target); it != indices.end())
+                        external_refs[it->second]--;
+                });
+            });
+        }
+
+        // the nodes referenced from elsewhere are alive, as well as everything they can reach
+        std::vector<bool> reachable(count, false);
+        std::vector<std::size_t> to_visit;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (external_refs[i] > 0)
+            {
+                reachable[i] = true;
+                to_visit.push_back(i);
+            }
+        }
+        while (!to_visit.empty())
+        {
+            std::size_t i = to_visit.back();
+            to_visit.pop_back();
+
+            forEachValue(i, [&](const Value& value) {
+                forEachReference(value, [&](const void* target) {
+                    if (auto it = indices.find(target); it != indices.end() && !reachable[it->second])
+                    {
+                        reachable[it->second] = true;
+                        to_visit.push_back(it->second);
+                    }
+                });
+            });
+        }
+
+        // the others are only kept alive by cycles, emptying them breaks the cycles
+        std::size_t collected = 0;
+        m_tracked.clear();
+        m_tracked_dicts.clear();
+        for (std::size_t i = 0, end = scopes.size(); i < end; ++i)
+        {
+            if (reachable[i])
+                m_tracked.emplace_back(scopes[i]);
+            else
+            {
+                scopes[i]->m_data.clear();
+                collected++;
+            }
+        }
+        for (std::size_t i = 0, end = dicts.size(); i < end; ++i)
+        {
+            if (reachable[scopes.size() + i])
+                m_tracked_dicts.emplace_back(dicts[i]);
+            else
+            {
+                dicts[i]->clear();
+                collected++;
+            }
+        }
+        scopes.clear();
+        dicts.clear();
+
+        m_stats.collections++;
+        m_stats.collected += collected;
+        m_stats.last_collected = collected;
+        // wait for the heap to double before collecting again, to avoid collecting the same live scopes over and over
+        m_next_collection = std::max(m_threshold, 2 * (m_tracked.size() + m_tracked_dicts.size()));
+
+        return collected;
+    }
+
+    void GarbageCollector::setThreshold(std::size_t threshold) noexcept
+    {
+        m_threshold = threshold;
+        m_next_collection = std::max(threshold, 2 * (m_tracked.size() + m_tracked_dicts.size()));
+    }
+
+    GCStats GarbageCollector::stats() const noexcept
+    {
+        GCStats stats = m_stats;
+        stats.tracked = m_tracked.size() + m_tracked_dicts.size();
+        stats.threshold = m_threshold;
+        stats.next_collection = m_next_collection;
+        return stats;
+    }
+}
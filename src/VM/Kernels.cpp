@@ -0,0 +1,368 @@
+#include <Ark/VM/Kernels.hpp>
+
+#include <algorithm>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ARK_KERNELS_SSE2
+    #include <emmintrin.h>
+#endif
+
+// the AVX kernels are compiled for the AVX target only, and selected at runtime
+#if defined(ARK_KERNELS_SSE2) && (defined(__GNUC__) || defined(__clang__))
+    #define ARK_KERNELS_AVX
+    #define ARK_TARGET_AVX __attribute__((target("avx")))
+    #include <immintrin.h>
+#endif
+
+namespace Ark::internal::kernels
+{
+    namespace
+    {
+#ifdef ARK_KERNELS_AVX
+        const bool has_avx = __builtin_cpu_supports("avx");
+
+        ARK_TARGET_AVX double reduceAdd(__m256d x) noexcept
+        {
+            __m128d pair = _mm_add_pd(_mm256_castpd256_pd128(x), _mm256_extractf128_pd(x, 1));
+            return _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+        }
+
+        ARK_TARGET_AVX std::size_t addAvx(const double* a, const double* b, double* out, std::size_t n) noexcept
+        {
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4)
+                _mm256_storeu_pd(out + i, _mm256_add_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+            return i;
+        }
+
+        ARK_TARGET_AVX std::size_t mulAvx(const double* a, const double* b, double* out, std::size_t n) noexcept
+        {
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4)
+                _mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+            return i;
+        }
+
+        ARK_TARGET_AVX std::size_t scaleAvx(const double* a, double k, double* out, std::size_t n) noexcept
+        {
+            __m256d factor = _mm256_set1_pd(k);
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4)
+                _mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_loadu_pd(a + i), factor));
+            return i;
+        }
+
+        ARK_TARGET_AVX std::size_t sumAvx(const double* a, std::size_t n, double& result) noexcept
+        {
+            // two accumulators to hide the latency of the additions
+            __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8)
+            {
+                acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(a + i));
+                acc1 = _mm256_add_pd(acc1, _mm256_loadu_pd(a + i + 4));
+            }
+            for (; i + 4 <= n; i += 4)
+                acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(a + i));
+            result = reduceAdd(_mm256_add_pd(acc0, acc1));
+            return i;
+        }
+
+        ARK_TARGET_AVX std::size_t dotAvx(const double* a, const double* b, std::size_t n, double& result) noexcept
+        {
+            __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8)
+            {
+                acc0 = _mm256_add_pd(acc0, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+                acc1 = _mm256_add_pd(acc1, _mm256_mul_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4)));
+            }
+            for (; i + 4 <= n; i += 4)
+                acc0 = _mm256_add_pd(acc0, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+            result = reduceAdd(_mm256_add_pd(acc0, acc1));
+            return i;
+        }
+
+        ARK_TARGET_AVX std::size_t minMaxAvx(const double* a, std::size_t n, bool is_min, double& result) noexcept
+        {
+            if (n < 4)
+                return 0;
+
+            // vminpd / vmaxpd return their second operand when one of them is NaN: the NaN are tracked on the side
+            __m256d acc = _mm256_loadu_pd(a);
+            __m256d nan = _mm256_cmp_pd(acc, acc, _CMP_UNORD_Q);
+            std::size_t i = 4;
+            if (is_min)
+            {
+                for (; i + 4 <= n; i += 4)
+                {
+                    __m256d x = _mm256_loadu_pd(a + i);
+                    nan = _mm256_or_pd(nan, _mm256_cmp_pd(x, x, _CMP_UNORD_Q));
+                    acc = _mm256_min_pd(acc, x);
+                }
+            }
+            else
+            {
+                for (; i + 4 <= n; i += 4)
+                {
+                    __m256d x = _mm256_loadu_pd(a + i);
+                    nan = _mm256_or_pd(nan, _mm256_cmp_pd(x, x, _CMP_UNORD_Q));
+                    acc = _mm256_max_pd(acc, x);
+                }
+            }
+
+            if (_mm256_movemask_pd(nan))
+            {
+                result = std::numeric_limits<double>::quiet_NaN();
+                return i;
+            }
+
+            alignas(32) double lanes[4];
+            _mm256_store_pd(lanes, acc);
+            result = is_min ? std::min({ lanes[0], lanes[1], lanes[2], lanes[3] }) : std::max({ lanes[0], lanes[1], lanes[2], lanes[3] });
+            return i;
+        }
+#endif
+
+#ifdef ARK_KERNELS_SSE2
+        std::size_t addSse2(const double* a, const double* b, double* out, std::size_t n) noexcept
+        {
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2)
+                _mm_storeu_pd(out + i, _mm_add_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+            return i;
+        }
+
+        std::size_t mulSse2(const double* a, const double* b, double* out, std::size_t n) noexcept
+        {
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2)
+                _mm_storeu_pd(out + i, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+            return i;
+        }
+
+        std::size_t scaleSse2(const double* a, double k, double* out, std::size_t n) noexcept
+        {
+            __m128d factor = _mm_set1_pd(k);
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2)
+                _mm_storeu_pd(out + i, _mm_mul_pd(_mm_loadu_pd(a + i), factor));
+            return i;
+        }
+
+        std::size_t sumSse2(const double* a, std::size_t n, double& result) noexcept
+        {
+            __m128d acc0 = _mm_setzero_pd(), acc1 = _mm_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4)
+            {
+                acc0 = _mm_add_pd(acc0, _mm_loadu_pd(a + i));
+                acc1 = _mm_add_pd(acc1, _mm_loadu_pd(a + i + 2));
+            }
+            for (; i + 2 <= n; i += 2)
+                acc0 = _mm_add_pd(acc0, _mm_loadu_pd(a + i));
+            acc0 = _mm_add_pd(acc0, acc1);
+            result = _mm_cvtsd_f64(_mm_add_sd(acc0, _mm_unpackhi_pd(acc0, acc0)));
+            return i;
+        }
+
+        std::size_t dotSse2(const double* a, const double* b, std::size_t n, double& result) noexcept
+        {
+            __m128d acc0 = _mm_setzero_pd(), acc1 = _mm_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4)
+            {
+                acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+                acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_loadu_pd(a + i + 2), _mm_loadu_pd(b + i + 2)));
+            }
+            for (; i + 2 <= n; i += 2)
+                acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+            acc0 = _mm_add_pd(acc0, acc1);
+            result = _mm_cvtsd_f64(_mm_add_sd(acc0, _mm_unpackhi_pd(acc0, acc0)));
+            return i;
+        }
+
+        std::size_t minMaxSse2(const double* a, std::size_t n, bool is_min, double& result) noexcept
+        {
+            if (n < 2)
+                return 0;
+
+            // same as the AVX version, minpd / maxpd don't propagate the NaN
+            __m128d acc = _mm_loadu_pd(a);
+            __m128d nan = _mm_cmpunord_pd(acc, acc);
+            std::size_t i = 2;
+            if (is_min)
+            {
+                for (; i + 2 <= n; i += 2)
+                {
+                    __m128d x = _mm_loadu_pd(a + i);
+                    nan = _mm_or_pd(nan, _mm_cmpunord_pd(x, x));
+                    acc = _mm_min_pd(acc, x);
+                }
+                result = _mm_cvtsd_f64(_mm_min_sd(acc, _mm_unpackhi_pd(acc, acc)));
+            }
+            else
+            {
+                for (; i + 2 <= n; i += 2)
+                {
+                    __m128d x = _mm_loadu_pd(a + i);
+                    nan = _mm_or_pd(nan, _mm_cmpunord_pd(x, x));
+                    acc = _mm_max_pd(acc, x);
+                }
+                result = _mm_cvtsd_f64(_mm_max_sd(acc, _mm_unpackhi_pd(acc, acc)));
+            }
+
+            if (_mm_movemask_pd(nan))
+                result = std::numeric_limits<double>::quiet_NaN();
+            return i;
+        }
+
+        // the AVX version isn't worth it: the shuffles between the two halves of the registers cost as much as they save
+        std::size_t prefixSumSse2(const double* a, double* out, std::size_t n, double& carry) noexcept
+        {
+            __m128d total = _mm_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2)
+            {
+                __m128d x = _mm_loadu_pd(a + i);
+                // [x0, x1] + [0, x0] + [total, total]
+                x = _mm_add_pd(x, _mm_unpacklo_pd(_mm_setzero_pd(), x));
+                x = _mm_add_pd(x, total);
+                _mm_storeu_pd(out + i, x);
+                total = _mm_unpackhi_pd(x, x);
+            }
+            carry = _mm_cvtsd_f64(total);
+            return i;
+        }
+#endif
+    }
+
+    const std::string& instructionSet() noexcept
+    {
+#if defined(ARK_KERNELS_AVX)
+        static const std::string name = has_avx ? "avx" : "sse2";
+#elif defined(ARK_KERNELS_SSE2)
+        static const std::string name = "sse2";
+#else
+        static const std::string name = "scalar";
+#endif
+        return name;
+    }
+
+    // each kernel handles as many elements as it can with the widest instructions available,
+    // then the remaining ones (or all of them without SIMD) are handled one by one
+
+    void add(const double* a, const double* b, double* out, std::size_t n) noexcept
+    {
+        std::size_t i = 0;
+#if defined(ARK_KERNELS_AVX)
+        i = has_avx ? addAvx(a, b, out, n) : addSse2(a, b, out, n);
+#elif defined(ARK_KERNELS_SSE2)
+        i = addSse2(a, b, out, n);
+#endif
+        for (; i < n; ++i)
+            out[i] = a[i] + b[i];
+    }
+
+    void mul(const double* a, const double* b, double* out, std::size_t n) noexcept
+    {
+        std::size_t i = 0;
+#if defined(ARK_KERNELS_AVX)
+        i = has_avx ? mulAvx(a, b, out, n) : mulSse2(a, b, out, n);
+#elif defined(ARK_KERNELS_SSE2)
+        i = mulSse2(a, b, out, n);
+#endif
+        for (; i < n; ++i)
+            out[i] = a[i] * b[i];
+    }
+
+    void scale(const double* a, double k, double* out, std::size_t n) noexcept
+    {
+        std::size_t i = 0;
+#if defined(ARK_KERNELS_AVX)
+        i = has_avx ? scaleAvx(a, k, out, n) : scaleSse2(a, k, out, n);
+#elif defined(ARK_KERNELS_SSE2)
+        i = scaleSse2(a, k, out, n);
+#endif
+        for (; i < n; ++i)
+            out[i] = a[i] * k;
+    }
+
+    double sum(const double* a, std::size_t n) noexcept
+    {
+        double result = 0.0;
+        std::size_t i = 0;
+#if defined(ARK_KERNELS_AVX)
+        i = has_avx ? sumAvx(a, n, result) : sumSse2(a, n, result);
+#elif defined(ARK_KERNELS_SSE2)
+        i = sumSse2(a, n, result);
+#endif
+        for (; i < n; ++i)
+            result += a[i];
+        return result;
+    }
+
+    double min(const double* a, std::size_t n) noexcept
+    {
+        double result = a[0];
+        std::size_t i = 0;
+#if defined(ARK_KERNELS_AVX)
+        i = has_avx ? minMaxAvx(a, n, true, result) : minMaxSse2(a, n, true, result);
+#elif defined(ARK_KERNELS_SSE2)
+        i = minMaxSse2(a, n, true, result);
+#endif
+        // a NaN is kept once it's in result, since the comparisons with it are false
+        for (; i < n; ++i)
+        {
+            if (a[i] < result || a[i] != a[i])
+                result = a[i];
+        }
+        return result;
+    }
+
+    double max(const double* a, std::size_t n) noexcept
+    {
+        double result = a[0];
+        std::size_t i = 0;
+#if defined(ARK_KERNELS_AVX)
+        i = has_avx ? minMaxAvx(a, n, false, result) : minMaxSse2(a, n, false, result);
+#elif defined(ARK_KERNELS_SSE2)
+        i = minMaxSse2(a, n, false, result);
+#endif
+        for (; i < n; ++i)
+        {
+            if (a[i] > result || a[i] != a[i])
+                result = a[i];
+        }
+        return result;
+    }
+
+    double dot(const double* a, const double* b, std::size_t n) noexcept
+    {
+        double result = 0.0;
+        std::size_t i = 0;
+#if defined(ARK_KERNELS_AVX)
+        i = has_avx ? dotAvx(a, b, n, result) : dotSse2(a, b, n, result);
+#elif defined(ARK_KERNELS_SSE2)
+        i = dotSse2(a, b, n, result);
+#endif
+        for (; i < n; ++i)
+            result += a[i] * b[i];
+        return result;
+    }
+
+    void prefixSum(const double* a, double* out, std::size_t n) noexcept
+    {
+        double total = 0.0;
+        std::size_t i = 0;
+#if defined(ARK_KERNELS_SSE2)
+        i = prefixSumSse2(a, out, n, total);
+#endif
+        for (; i < n; ++i)
+        {
+            total += a[i];
+            out[i] = total;
+        }
+    }
+}
@@ -0,0 +1,34 @@
+#include <Ark/VM/MemoryStats.hpp>
+
+#include <iomanip>
+
+namespace Ark
+{
+    std::vector<std::pair<std::string, std::size_t>> MemoryStats::fields() const
+    {
+        return {
+            { "values", values },
+            { "list_bytes", list_bytes },
+            { "string_bytes", string_bytes },
+            { "scopes", scopes },
+            { "scope_bytes", scope_bytes },
+            { "frames", frames },
+            { "frame_bytes", frame_bytes },
+            { "closures", closures },
+            { "frames_created", frames_created },
+            { "scopes_created", scopes_created },
+            { "closures_created", closures_created },
+            { "dicts_created", dicts_created },
+            { "max_frames", max_frames },
+            { "max_locals", max_locals }
+        };
+    }
+
+    std::ostream& operator<<(std::ostream& os, const MemoryStats& stats)
+    {
+        os << "\nMemory:\n";
+        for (auto&& [name, value] : stats.fields())
+            os << std::left << std::setw(24) << name << std::right << std::setw(14) << value << "\n";
+        return os;
+    }
+}
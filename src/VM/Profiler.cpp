@@ -0,0 +1,186 @@
+#include <Ark/VM/Profiler.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+
+#include <Ark/Compiler/Instructions.hpp>
+#include <Ark/Builtins/Builtins.hpp>
+
+namespace Ark::internal
+{
+    namespace
+    {
+        // names of the commands, indexed by their value (the operators are named in Builtins::operators)
+        const std::array<std::string, LAST_COMMAND + 1> commands_names = {
+            "NOP",
+            "LOAD_SYMBOL", "LOAD_CONST", "POP_JUMP_IF_TRUE", "STORE", "LET",
+            "POP_JUMP_IF_FALSE", "JUMP", "RET", "HALT", "CALL", "CAPTURE",
+            "BUILTIN", "MUT", "DEL", "SAVE_ENV", "GET_FIELD", "PLUGIN",
+            "LIST", "APPEND", "CONCAT", "APPEND_IN_PLACE", "CONCAT_IN_PLACE",
+            "SET_AT_IN_PLACE", "ERASE_IN_PLACE"
+        };
+
+        std::string instructionName(std::size_t inst)
+        {
+            if (inst <= LAST_COMMAND)
+                return commands_names[inst];
+            else if (inst >= FIRST_OPERATOR && inst - FIRST_OPERATOR < Builtins::operators.size())
+                return Builtins::operators[inst - FIRST_OPERATOR];
+
+            std::ostringstream name;
+            name << "0x" << std::hex << std::setw(2) << std::setfill('0') << inst;
+            return name.str();
+        }
+
+        // the names of the functions come from the code, they can hold quotes and backslashes
+        std::string escapeJSON(const std::string& str)
+        {
+            std::ostringstream output;
+            for (char c : str)
+            {
+                if (c == '"' || c == '\\')
+                    output << '\\' << c;
+                else if (static_cast<unsigned char>(c) < 0x20)
+                    output << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+                else
+                    output << c;
+            }
+            return output.str();
+        }
+
+        double toMs(std::chrono::nanoseconds duration)
+        {
+            return std::chrono::duration<double, std::milli>(duration).count();
+        }
+    }
+
+    Profiler::Profiler(std::size_t pages_count) noexcept :
+        m_pages(pages_count), m_active(pages_count, 0)
+    {
+        m_instructions.fill(0);
+    }
+
+    void Profiler::enter(std::size_t page, uint16_t symbol_id, std::size_t depth) noexcept
+    {
+        m_pages[page].calls++;
+        if (m_pages[page].symbol_id == 0xffff)
+            m_pages[page].symbol_id = symbol_id;
+        m_active[page]++;
+
+        m_stack.push_back(Entry { page, depth, Clock::now(), std::chrono::nanoseconds(0) });
+    }
+
+    void Profiler::leave(std::size_t depth) noexcept
+    {
+        if (m_stack.empty() || m_stack.back().depth != depth)
+            return;
+
+        Entry entry = m_stack.back();
+        m_stack.pop_back();
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - entry.start);
+        PageStats& stats = m_pages[entry.page];
+
+        stats.exclusive += elapsed - entry.children;
+        // only the outermost call of a recursive function counts in its inclusive time
+        m_active[entry.page]--;
+        if (m_active[entry.page] == 0)
+            stats.inclusive += elapsed;
+
+        if (!m_stack.empty())
+            m_stack.back().children += elapsed;
+    }
+
+    void Profiler::leaveAll() noexcept
+    {
+        while (!m_stack.empty())
+            leave(m_stack.back().depth);
+    }
+
+    void Profiler::report(std::ostream& os, const std::vector<std::string>& symbols) const
+    {
+        std::vector<std::size_t> pages(m_pages.size());
+        std::iota(pages.begin(), pages.end(), 0);
+        std::sort(pages.begin(), pages.end(), [this](std::size_t a, std::size_t b) {
+            return m_pages[a].exclusive > m_pages[b].exclusive;
+        });
+
+        os << "\nFunctions, sorted by exclusive time:\n";
+        os << std::left << std::setw(24) << "name" << std::right
+           << std::setw(10) << "calls" << std::setw(14) << "instructions"
+           << std::setw(16) << "inclusive (ms)" << std::setw(16) << "exclusive (ms)" << "\n";
+        for (std::size_t page : pages)
+        {
+            const PageStats& stats = m_pages[page];
+            if (stats.calls == 0 && stats.instructions == 0)
+                continue;
+
+            os << std::left << std::setw(24) << pageName(page, symbols) << std::right
+               << std::setw(10) << stats.calls << std::setw(14) << stats.instructions
+               << std::fixed << std::setprecision(3)
+               << std::setw(16) << toMs(stats.inclusive) << std::setw(16) << toMs(stats.exclusive) << "\n";
+        }
+
+        std::vector<std::size_t> insts(m_instructions.size());
+        std::iota(insts.begin(), insts.end(), 0);
+        std::sort(insts.begin(), insts.end(), [this](std::size_t a, std::size_t b) {
+            return m_instructions[a] > m_instructions[b];
+        });
+        uint64_t total = std::accumulate(m_instructions.begin(), m_instructions.end(), uint64_t(0));
+
+        os << "\nInstructions, sorted by count (total: " << total << "):\n";
+        for (std::size_t inst : insts)
+        {
+            if (m_instructions[inst] == 0)
+                break;
+
+            os << std::left << std::setw(24) << instructionName(inst) << std::right
+               << std::setw(14) << m_instructions[inst]
+               << std::setw(9) << std::setprecision(2) << (100.0 * m_instructions[inst] / total) << "%\n";
+        }
+        os << std::defaultfloat;
+    }
+
+    void Profiler::toJSON(std::ostream& os, const std::vector<std::string>& symbols) const
+    {
+        os << "{\n  \"functions\": [";
+        bool first = true;
+        for (std::size_t page = 0, end = m_pages.size(); page < end; ++page)
+        {
+            const PageStats& stats = m_pages[page];
+            if (stats.calls == 0 && stats.instructions == 0)
+                continue;
+
+            os << (first ? "" : ",") << "\n    { \"page\": " << page
+               << ", \"name\": \"" << escapeJSON(pageName(page, symbols)) << "\""
+               << ", \"calls\": " << stats.calls
+               << ", \"instructions\": " << stats.instructions
+               << ", \"inclusive_ns\": " << stats.inclusive.count()
+               << ", \"exclusive_ns\": " << stats.exclusive.count() << " }";
+            first = false;
+        }
+
+        os << "\n  ],\n  \"instructions\": {";
+        first = true;
+        for (std::size_t inst = 0, end = m_instructions.size(); inst < end; ++inst)
+        {
+            if (m_instructions[inst] == 0)
+                continue;
+
+            os << (first ? "" : ",") << "\n    \"" << escapeJSON(instructionName(inst)) << "\": " << m_instructions[inst];
+            first = false;
+        }
+        os << "\n  }\n}\n";
+    }
+
+    std::string Profiler::pageName(std::size_t page, const std::vector<std::string>& symbols) const
+    {
+        if (page == 0)
+            return "<global>";
+        else if (m_pages[page].symbol_id < symbols.size())
+            return symbols[m_pages[page].symbol_id];
+        return "<page " + std::to_string(page) + ">";
+    }
+}
@@ -0,0 +1,45 @@
+#include <Ark/VM/Range.hpp>
+
+#include <cmath>
+#include <algorithm>
+
+#include <Ark/VM/Value.hpp>
+
+namespace Ark::internal
+{
+    double Range::count(double start, double end, double step) noexcept
+    {
+        double count = std::ceil((end - start) / step);
+        // also false for NaN
+        return count > 0 ? count : 0;
+    }
+
+    Range::Range(double start, double end, double step) noexcept :
+        m_start(start), m_end(end), m_step(step), m_size(0), m_index(0)
+    {
+        // converting a double bigger than the destination type is undefined behaviour
+        m_size = static_cast<std::size_t>(std::min(count(start, end, step), static_cast<double>(MaxSize)));
+    }
+
+    std::size_t Range::size() const noexcept
+    {
+        return m_size;
+    }
+
+    bool isEmpty(const Range& R) noexcept
+    {
+        return R.size() == 0;
+    }
+
+    bool operator==(const Range& A, const Range& B) noexcept
+    {
+        return A.m_start == B.m_start && A.m_end == B.m_end && A.m_step == B.m_step;
+    }
+
+    std::ostream& operator<<(std::ostream& os, const Range& R) noexcept
+    {
+        // printed as the expression creating it
+        os << "(iter:range " << Value(R.m_start) << " " << Value(R.m_end) << " " << Value(R.m_step) << ")";
+        return os;
+    }
+}
@@ -0,0 +1,72 @@
+#include <Ark/VM/Sampler.hpp>
+
+namespace Ark::internal
+{
+    Sampler::Sampler(unsigned rate) noexcept :
+        m_interval(1000000 / (rate == 0 ? 1 : rate)), m_requested(false), m_running(false)
+    {}
+
+    Sampler::~Sampler()
+    {
+        stop();
+    }
+
+    void Sampler::start()
+    {
+        if (m_running)
+            return;
+
+        m_running = true;
+        m_thread = std::thread([this]() {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            // wake up at each tick, or earlier if we are asked to stop
+            while (!m_cv.wait_for(lock, m_interval, [this]() { return !m_running; }))
+                m_requested.store(true, std::memory_order_relaxed);
+        });
+    }
+
+    void Sampler::stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_running)
+                return;
+            m_running = false;
+        }
+
+        m_cv.notify_one();
+        m_thread.join();
+    }
+
+    void Sampler::sample(const std::vector<Frame>& frames, int ip)
+    {
+        m_requested.store(false, std::memory_order_relaxed);
+
+        std::vector<std::size_t> stack;
+        stack.reserve(frames.size() + 1);
+        for (const Frame& frame : frames)
+            stack.push_back(frame.currentPageAddr());
+        stack.push_back(static_cast<std::size_t>(ip < 0 ? 0 : ip));
+
+        m_stacks[stack]++;
+    }
+
+    void Sampler::toFolded(std::ostream& os, const std::vector<std::string>& pages_names) const
+    {
+        for (const auto& [stack, count] : m_stacks)
+        {
+            // the last element is the instruction pointer, added to the name of the current function
+            for (std::size_t i = 0, end = stack.size() - 1; i < end; ++i)
+            {
+                if (i != 0)
+                    os << ";";
+
+                if (stack[i] < pages_names.size())
+                    os << pages_names[stack[i]];
+                else
+                    os << "<page " << stack[i] << ">";
+            }
+            os << "@" << stack.back() << " " << count << "\n";
+        }
+    }
+}
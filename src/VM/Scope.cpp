@@ -18,6 +18,16 @@ namespace Ark::internal
     #endif
     }
 
+    void Scope::reserve(std::size_t size) noexcept
+    {
+        m_data.reserve(size);
+    }
+
+    void Scope::clear() noexcept
+    {
+        m_data.clear();
+    }
+
     void Scope::push_back(uint16_t id, Value&& val) noexcept
     {
     #ifdef ARK_SCOPE_DICHOTOMY
@@ -110,6 +120,35 @@ namespace Ark::internal
     #endif
     }
 
+    Value* Scope::lookupCached(uint16_t id, uint16_t& slot) noexcept
+    {
+        // a single comparison is enough to validate the slot, because ids are unique in a scope
+        if (slot < m_data.size() && m_data[slot].first == id)
+            return &m_data[slot].second;
+
+    #ifdef ARK_SCOPE_DICHOTOMY
+        auto lower = std::lower_bound(m_data.begin(), m_data.end(), id, [](const auto& lhs, uint16_t id) -> bool {
+            return lhs.first < id;
+        });
+        if (lower != m_data.end() && lower->first == id)
+        {
+            slot = static_cast<uint16_t>(std::distance(m_data.begin(), lower));
+            return &lower->second;
+        }
+        return nullptr;
+    #else
+        for (std::size_t i=0, end=m_data.size(); i < end; ++i)
+        {
+            if (m_data[i].first == id)
+            {
+                slot = static_cast<uint16_t>(i);
+                return &m_data[i].second;
+            }
+        }
+        return nullptr;
+    #endif
+    }
+
     uint16_t Scope::idFromValue(Value&& val) noexcept
     {
         for (std::size_t i=0, end=m_data.size(); i < end; ++i)
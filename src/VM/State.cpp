@@ -163,11 +163,66 @@ namespace Ark
         return true;
     }
 
+    bool State::doStringIncremental(const std::string& code)
+    {
+        using namespace Ark::internal;
+
+        if (!m_incremental_compiler)
+            m_incremental_compiler = std::make_unique<Compiler>(m_debug_level, m_libdir, m_options);
+        Compiler& compiler = *m_incremental_compiler;
+
+        try
+        {
+            compiler.feed(code);
+            compiler.compileIncremental();
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << typeid(e).name() << ": " << e.what() << std::endl;
+            return false;
+        }
+        catch (...)
+        {
+            std::cerr << "Unknown lexer-parser-or-compiler error" << std::endl;
+            return false;
+        }
+
+        // the compiler kept the previous tables, we only need to load what is new
+        for (std::size_t i=m_symbols.size(), end=compiler.m_symbols.size(); i < end; ++i)
+        {
+            m_symbols_ids.emplace(compiler.m_symbols[i].string(), static_cast<uint16_t>(i));
+            m_symbols.push_back(compiler.m_symbols[i].string());
+        }
+
+        for (std::size_t i=m_constants.size(), end=compiler.m_values.size(); i < end; ++i)
+        {
+            const CValue& val = compiler.m_values[i];
+            if (val.type == CValueType::Number)
+                m_constants.emplace_back(std::get<double>(val.value));
+            else if (val.type == CValueType::String)
+                m_constants.emplace_back(std::get<std::string>(val.value));
+            else
+                m_constants.emplace_back(static_cast<PageAddr_t>(std::get<std::size_t>(val.value)));
+        }
+
+        m_incremental_page = m_pages.size();
+        for (std::size_t i=m_pages.size(), end=compiler.m_code_pages.size(); i < end; ++i)
+            m_pages.push_back(compiler.m_code_pages[i]);
+        computePagesMetadata();
+
+        return true;
+    }
+
     void State::loadFunction(const std::string& name, internal::Value::ProcType function) noexcept
     {
         m_binded[name] = internal::Value(std::move(function));
     }
 
+    void State::loadFunction(const std::string& name, internal::Value::FastProcType function) noexcept
+    {
+        m_binded[name] = internal::Value(function);
+    }
+
     void State::setArgs(const std::vector<std::string>& args) noexcept
     {
         internal::Value val(internal::ValueType::List);
@@ -209,7 +264,8 @@ namespace Ark
         uint16_t minor = readNumber(i); i++;
         uint16_t patch = readNumber(i); i++;
 
-        if (major != ARK_VERSION_MAJOR)
+        // the minor versions can add builtins, instructions and value types, changing their ids
+        if (major != ARK_VERSION_MAJOR || minor != ARK_VERSION_MINOR)
         {
             std::string str_version = Ark::Utils::toString(major) + "." +
                 Ark::Utils::toString(minor) + "." +
@@ -257,6 +313,7 @@ namespace Ark
                     symbol.push_back(m_bytecode[i++]);
                 i++;
 
+                m_symbols_ids.emplace(symbol, static_cast<uint16_t>(m_symbols.size()));
                 m_symbols.push_back(symbol);
             }
         }
@@ -323,14 +380,70 @@ namespace Ark
             if (i == m_bytecode.size())
                 break;
         }
+
+        computePagesMetadata();
+    }
+
+    void State::computePagesMetadata() noexcept
+    {
+        using namespace Ark::internal;
+
+        std::size_t first_page = m_pages_metadata.size();
+        m_pages_metadata.resize(m_pages.size());
+
+        for (std::size_t pp=first_page, end=m_pages.size(); pp < end; ++pp)
+        {
+            const bytecode_t& page = m_pages[pp];
+            PageMetadata& meta = m_pages_metadata[pp];
+
+            // every argument is a MUT declaration at the beginning of the page
+            std::size_t i = 0;
+            while (i < page.size() && page[i] == Instruction::MUT)
+            {
+                meta.arity++;
+                i += 3;  // jump the argument of MUT (integer on 2 bytes, big endian)
+            }
+
+            for (i=0; i < page.size(); )
+            {
+                uint8_t inst = page[i];
+                if (inst == Instruction::LET || inst == Instruction::MUT)
+                    meta.locals_count++;
+                // LOAD_CONST function followed by LET/MUT/STORE symbol gives a name to the function
+                else if (inst == Instruction::LOAD_CONST && i + 5 < page.size() &&
+                    (page[i + 3] == Instruction::LET || page[i + 3] == Instruction::MUT || page[i + 3] == Instruction::STORE))
+                {
+                    uint16_t const_id = (static_cast<uint16_t>(page[i + 1]) << 8) + static_cast<uint16_t>(page[i + 2]);
+                    uint16_t sym_id = (static_cast<uint16_t>(page[i + 4]) << 8) + static_cast<uint16_t>(page[i + 5]);
+
+                    if (const_id < m_constants.size() && m_constants[const_id].valueType() == ValueType::PageAddr)
+                    {
+                        PageAddr_t addr = m_constants[const_id].pageAddr();
+                        if (addr < m_pages_metadata.size() && m_pages_metadata[addr].name_id == 0xffff)
+                            m_pages_metadata[addr].name_id = sym_id;
+                    }
+                }
+
+                // commands take a 2 bytes argument, except the ones below
+                if (inst >= Instruction::FIRST_COMMAND && inst <= Instruction::LAST_COMMAND &&
+                    inst != Instruction::RET && inst != Instruction::HALT && inst != Instruction::SAVE_ENV)
+                    i += 3;
+                else
+                    i += 1;
+            }
+        }
     }
 
     void State::reset() noexcept
     {
         m_symbols.clear();
+        m_symbols_ids.clear();
         m_constants.clear();
         m_pages.clear();
-        m_binded.clear(); 
+        m_pages_metadata.clear();
+        m_binded.clear();
+        m_incremental_compiler.reset();
+        m_incremental_page = 0;
     }
 }
 
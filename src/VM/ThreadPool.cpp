@@ -0,0 +1,107 @@
+#include <Ark/VM/ThreadPool.hpp>
+
+#include <algorithm>
+
+namespace Ark::internal
+{
+    ThreadPool::ThreadPool(std::size_t workers) :
+        m_stop(false)
+    {
+        m_workers.reserve(workers);
+        for (std::size_t i = 0; i < workers; ++i)
+            m_workers.emplace_back([this]() {
+                while (true)
+                {
+                    std::shared_ptr<Job> job;
+                    {
+                        std::unique_lock<std::mutex> lock(m_mutex);
+                        m_wake_up.wait(lock, [this]() { return m_stop || !m_jobs.empty(); });
+                        if (m_stop)
+                            return;
+
+                        job = m_jobs.front();
+                        // every task of the job was already taken
+                        if (job->next >= job->count)
+                        {
+                            m_jobs.pop_front();
+                            continue;
+                        }
+                    }
+                    job->work();
+                }
+            });
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake_up.notify_all();
+        for (std::thread& worker : m_workers)
+            worker.join();
+    }
+
+    void ThreadPool::run(std::size_t count, const std::function<void(std::size_t)>& task)
+    {
+        if (count == 0)
+            return;
+
+        auto job = std::make_shared<Job>(task, count);
+        if (count > 1 && !m_workers.empty())
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_jobs.push_back(job);
+            }
+            m_wake_up.notify_all();
+        }
+
+        // help the workers, or do everything if they are all busy
+        job->work();
+
+        {
+            std::unique_lock<std::mutex> lock(job->mutex);
+            job->finished.wait(lock, [&job]() { return job->done == job->count; });
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_jobs.erase(std::remove(m_jobs.begin(), m_jobs.end(), job), m_jobs.end());
+        }
+
+        if (job->error)
+            std::rethrow_exception(job->error);
+    }
+
+    std::size_t ThreadPool::concurrency() const noexcept
+    {
+        return m_workers.size() + 1;
+    }
+
+    ThreadPool& ThreadPool::global()
+    {
+        static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+        return pool;
+    }
+
+    void ThreadPool::Job::work()
+    {
+        for (std::size_t i = next++; i < count; i = next++)
+        {
+            try {
+                task(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+
+            if (++done == count)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                finished.notify_all();
+            }
+        }
+    }
+}
@@ -1,5 +1,8 @@
 #include <Ark/VM/VM.hpp>
 
+#include <Ark/VM/Dict.hpp>
+#include <Ark/VM/Range.hpp>
+
 // read a number from the bytecode
 #define readNumber(var) {                                                \
     var = (static_cast<uint16_t>(m_state->m_pages[m_pp][m_ip]) << 8) +   \
@@ -12,6 +15,7 @@
 #define registerVarGlobal(id, value) ((*m_locals[0]).push_back(id, value))
 // stack management
 #define popVal() m_frames.back().pop()
+#define peekVal() m_frames.back().peek()
 #define popValFrom(page) m_frames[static_cast<std::size_t>(page)].pop()
 #define push(value) m_frames.back().push(value)
 // create a new locals scope
@@ -26,7 +30,7 @@ struct mapping {
 
 namespace Ark
 {
-    VM::VM(State* state) noexcept :
+    VM::VM(const State* state) noexcept :
         m_state(state), m_exitCode(0), m_ip(0), m_pp(0),
         m_running(false), m_last_sym_loaded(0),
         m_until_frame_count(0), m_user_pointer(nullptr)
@@ -35,100 +39,186 @@ namespace Ark
         m_locals.reserve(4);
     }
 
-    void VM::init() noexcept
+    VM::~VM()
+    {
+        flush();
+    }
+
+    void VM::init()
     {
         using namespace Ark::internal;
 
-        // clearing frames and setting up a new one
+        // clearing frames and locals (scopes), and setting up the global ones
         if ((m_state->m_options & FeaturePersist) == 0)
+            reset();
+        else
         {
-            m_frames.clear();
-            m_frames.emplace_back();
-            m_shared_lib_objects.clear();
-        }
-        else if (m_frames.size() == 0)
-        {
-            // if persistance is set but no frames are present, add one
+            // if persistance is set but no frames or scopes are present, add them
             // it usually happens on the first run
-            m_frames.emplace_back();
+            if (m_frames.size() == 0)
+                m_frames.emplace_back();
+            if (m_locals.size() == 0)
+                createNewScope();
+            m_saved_scope.reset();
         }
 
-        m_saved_scope.reset();
         m_exitCode = 0;
 
-        // clearing locals (scopes) and create a global scope
-        if ((m_state->m_options & FeaturePersist) == 0)
+        // loading binded stuff
+        // put them in the global frame if we can, aka the first one
+        for (const auto& [name, value] : m_state->m_binded)
         {
-            m_locals.clear();
-            createNewScope();
+            if (auto it = m_state->m_symbols_ids.find(name); it != m_state->m_symbols_ids.end())
+                registerVarGlobal(it->second, value);
         }
-        else if (m_locals.size() == 0)
+        m_known_symbols = m_state->m_symbols.size();
+
+        // reset the memory counters
+        m_memory = MemoryStats();
+        m_memory.max_frames = m_frames.size();
+        m_memory.max_locals = m_locals.size();
+    }
+
+    void VM::reset()
+    {
+        using namespace Ark::internal;
+
+        // keep the global frame and the memory of its stack
+        if (m_frames.size() == 0)
+            m_frames.emplace_back();
+        else
         {
-            // if persistance is set but not scopes are present, add one
-            createNewScope();
+            m_frames.erase(m_frames.begin() + 1, m_frames.end());
+            m_frames[0].reset();
         }
+        // the plugins stay loaded, their functions are registered again by the next run
+        m_saved_scope.reset();
+        ++m_generation;
 
-        // loading binded stuff
-        // put them in the global frame if we can, aka the first one
-        for (auto name_val : m_state->m_binded)
+        // keep the global scope as well, unless a closure is still holding it
+        if (m_locals.size() > 0 && m_locals[0].use_count() == 1)
         {
-            auto it = std::find(m_state->m_symbols.begin(), m_state->m_symbols.end(), name_val.first);
-            if (it != m_state->m_symbols.end())
-                registerVarGlobal(static_cast<uint16_t>(std::distance(m_state->m_symbols.begin(), it)), name_val.second);
+            m_locals.erase(m_locals.begin() + 1, m_locals.end());
+            m_locals[0]->clear();
+        }
+        else
+        {
+            m_locals.clear();
+            createNewScope();
         }
+        m_gc.collect();
+
+        m_ip = 0;
+        m_pp = 0;
     }
 
     internal::Value& VM::operator[](const std::string& name) noexcept
     {
         using namespace Ark::internal;
 
-        const std::lock_guard<std::mutex> lock(m_mutex);
+        const std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
         // find id of object
-        auto it = std::find(m_state->m_symbols.begin(), m_state->m_symbols.end(), name);
-        if (it == m_state->m_symbols.end())
+        auto it = m_state->m_symbols_ids.find(name);
+        if (it == m_state->m_symbols_ids.end())
         {
             m__no_value = Builtins::nil;
             return m__no_value;
         }
 
-        uint16_t id = static_cast<uint16_t>(std::distance(m_state->m_symbols.begin(), it));
-        Value* var = findNearestVariable(id);
+        Value* var = findNearestVariable(it->second);
         if (var != nullptr)
+        {
+            // the host reads the lists with const_list
+            var->unshareLists();
             return *var;
+        }
         m__no_value = Builtins::nil;
         return m__no_value;
     }
 
+    std::unique_ptr<VM> VM::fork() const
+    {
+        using namespace Ark::internal;
+
+        auto vm = std::make_unique<VM>(m_state);
+        vm->init();
+        vm->m_forked = true;
+        vm->m_user_pointer = m_user_pointer;
+        vm->m_shared_lib_objects = m_shared_lib_objects;
+
+        // share the scopes instead of copying every variable: the functions called on the copy only read them.
+        // Their lists are moved to shared buffers now, the copy loads them without copying nor modifying them
+        for (const Scope_t& scope : m_locals)
+        {
+            for (auto& [id, value] : scope->m_data)
+            {
+                if (value.valueType() == ValueType::List)
+                    value.shareList();
+            }
+        }
+        vm->m_locals = m_locals;
+
+        return vm;
+    }
+
+    FunctionHandle VM::getFunction(const std::string& name)
+    {
+        using namespace Ark::internal;
+
+        // find id of function
+        auto it = m_state->m_symbols_ids.find(name);
+        if (it == m_state->m_symbols_ids.end())
+            throwVMError("unbound variable: " + name);
+
+        Value* var = findNearestVariable(it->second);
+        if (var == nullptr)
+            throwVMError("Couldn't find variable " + name);
+        if (var->valueType() != ValueType::PageAddr && var->valueType() != ValueType::Closure)
+            throwVMError("Can't call '" + name + "': it isn't a Function but a " + types_to_str[static_cast<int>(var->valueType())]);
+
+        return FunctionHandle(*var, it->second, this, m_generation);
+    }
+
     void VM::loadPlugin(uint16_t id)
     {
         using namespace Ark::internal;
         namespace fs = std::filesystem;
 
-        std::string file = m_state->m_constants[id].string_ref().toString();
+        std::string file = m_state->m_constants[id].string().c_str();
         std::string path = "./" + file;
 
         if (m_state->m_filename != ARK_NO_NAME_FILE)  // bytecode loaded from file
             path = "./" + (fs::path(m_state->m_filename).parent_path() / fs::path(file)).string();
         std::string lib_path = (fs::path(m_state->m_libdir) / fs::path(file)).string();
 
-        if (std::find_if(m_shared_lib_objects.begin(), m_shared_lib_objects.end(), [&, this](const auto& val) {
+        // a plugin loaded by a previous run is kept, but the global scope was emptied since
+        auto lib = std::find_if(m_shared_lib_objects.begin(), m_shared_lib_objects.end(), [&, this](const auto& val) {
             return (val->path() == path || val->path() == lib_path);
-        }) != m_shared_lib_objects.end())
-            return;
+        });
+        if (lib == m_shared_lib_objects.end())
+        {
+            if (Utils::fileExists(path))  // if it exists alongside the .arkc file
+                m_shared_lib_objects.emplace_back(std::make_shared<SharedLibrary>(path));
+            else if (Utils::fileExists(lib_path))  // check in LOAD_PATH otherwise
+                m_shared_lib_objects.emplace_back(std::make_shared<SharedLibrary>(lib_path));
+            else
+                throwVMError("could not load plugin: " + file);
+            lib = std::prev(m_shared_lib_objects.end());
+        }
 
-        if (Utils::fileExists(path))  // if it exists alongside the .arkc file
-            m_shared_lib_objects.emplace_back(std::make_shared<SharedLibrary>(path));
-        else if (Utils::fileExists(lib_path))  // check in LOAD_PATH otherwise
-            m_shared_lib_objects.emplace_back(std::make_shared<SharedLibrary>(lib_path));
-        else
-            throwVMError("could not load plugin: " + file);
+        registerPluginFunctions(**lib, 0);
+    }
+
+    void VM::registerPluginFunctions(internal::SharedLibrary& lib, std::size_t first_id)
+    {
+        using namespace Ark::internal;
 
         // load data from it
         mapping* map;
 
         try {
-            map = m_shared_lib_objects.back()->template get<mapping* (*)()>("getFunctionsMapping")();
+            map = lib.template get<mapping* (*)()>("getFunctionsMapping")();
         } catch (const std::system_error& e) {
             throwVMError(std::string(e.what()));
         }
@@ -137,9 +227,8 @@ namespace Ark
         while (map[i].name != nullptr)
         {
             // put it in the global frame, aka the first one
-            auto it = std::find(m_state->m_symbols.begin(), m_state->m_symbols.end(), std::string(map[i].name));
-            if (it != m_state->m_symbols.end())
-                registerVarGlobal(static_cast<uint16_t>(std::distance(m_state->m_symbols.begin(), it)), Value(map[i].value));
+            if (auto it = m_state->m_symbols_ids.find(map[i].name); it != m_state->m_symbols_ids.end() && it->second >= first_id)
+                registerVarGlobal(it->second, Value(map[i].value));
 
             // free memory because we have used it and don't need it anymore
             // no need to free map[i].value since it's a pointer to a function in the DLL
@@ -151,10 +240,27 @@ namespace Ark
         delete[] map;
     }
 
+    void VM::registerNewSymbols(std::size_t first_id)
+    {
+        using namespace Ark::internal;
+
+        for (const auto& [name, value] : m_state->m_binded)
+        {
+            if (auto it = m_state->m_symbols_ids.find(name); it != m_state->m_symbols_ids.end() && it->second >= first_id)
+                registerVarGlobal(it->second, value);
+        }
+        // the import of a plugin is run only once, the functions used for the first time by the new code are added here
+        for (const std::shared_ptr<SharedLibrary>& lib : m_shared_lib_objects)
+            registerPluginFunctions(*lib, first_id);
+
+        m_known_symbols = m_state->m_symbols.size();
+    }
+
     void VM::exit(int code) noexcept
     {
         m_exitCode = code;
         m_running = false;
+        m_exited = true;
     }
 
     // ------------------------------------------
@@ -171,6 +277,140 @@ namespace Ark
         return m_user_pointer;
     }
 
+    std::ostream& VM::output()
+    {
+        if (!(m_state->m_options & FeatureBufferedOutput))
+            return std::cout;
+
+        // write big chunks instead of keeping everything until the end of the program
+        if (m_output.tellp() >= 64 * 1024)
+        {
+            std::cout << m_output.str();
+            m_output.str("");
+        }
+        return m_output;
+    }
+
+    void VM::flush()
+    {
+        if (m_output.tellp() > 0)
+        {
+            std::cout << m_output.str();
+            m_output.str("");
+        }
+        std::cout.flush();
+    }
+
+    void VM::enableProfiler() noexcept
+    {
+        m_profiler = std::make_unique<internal::Profiler>(m_state->m_pages.size());
+    }
+
+    void VM::displayProfile(std::ostream& os, bool json) const
+    {
+        if (!m_profiler)
+            return;
+
+        if (json)
+            m_profiler->toJSON(os, m_state->m_symbols);
+        else
+        {
+            m_profiler->report(os, m_state->m_symbols);
+            os << memoryStats();
+        }
+    }
+
+    MemoryStats VM::memoryStats() const
+    {
+        using namespace Ark::internal;
+
+        MemoryStats stats = m_memory;
+        std::unordered_set<const void*> visited;
+
+        stats.frames = m_frames.size();
+        for (const Frame& frame : m_frames)
+        {
+            stats.frame_bytes += sizeof(Frame) + frame.m_stack.capacity() * sizeof(Value);
+            for (int16_t i = 0; i < frame.m_i; ++i)
+                accountValue(frame.m_stack[i], stats, visited);
+        }
+
+        for (const Scope_t& scope : m_locals)
+            accountScope(scope.get(), stats, visited);
+        if (m_saved_scope)
+            accountScope(m_saved_scope.value().get(), stats, visited);
+
+        return stats;
+    }
+
+    void VM::enableSampler(unsigned rate) noexcept
+    {
+        m_sampler = std::make_unique<internal::Sampler>(rate);
+    }
+
+    void VM::writeSamples(std::ostream& os) const
+    {
+        if (!m_sampler)
+            return;
+
+        // name the functions after the symbols they were bound to
+        std::vector<std::string> names(m_state->m_pages.size());
+        for (std::size_t i = 0, end = names.size(); i < end; ++i)
+        {
+            uint16_t id = m_state->m_pages_metadata[i].name_id;
+            if (i == 0)
+                names[i] = "<global>";
+            else if (id < m_state->m_symbols.size())
+                names[i] = m_state->m_symbols[id];
+            else
+                names[i] = "<page " + std::to_string(i) + ">";
+        }
+
+        m_sampler->toFolded(os, names);
+    }
+
+    std::size_t VM::collectGarbage()
+    {
+        return m_gc.collect();
+    }
+
+    void VM::trackDict(const internal::Value& dict)
+    {
+        using namespace Ark::internal;
+
+        m_gc.track(std::get<std::shared_ptr<Dict>>(dict.m_value));
+        m_memory.dicts_created++;
+        if (m_gc.shouldCollect())
+            m_gc.collect();
+    }
+
+    void VM::unshareObject(internal::Value& value)
+    {
+        using namespace Ark::internal;
+
+        if (value.valueType() == ValueType::Dict)
+        {
+            // the new dictionary can end up holding itself, once it has its own entries
+            auto dict = std::make_shared<Dict>(value.const_dict());
+            m_gc.track(dict);
+            value.m_value = std::move(dict);
+            if (m_gc.shouldCollect())
+                m_gc.collect();
+        }
+        else if (value.valueType() == ValueType::Range)
+            value.m_value = std::make_shared<Range>(value.const_range());
+    }
+
+    void VM::setGCThreshold(std::size_t threshold) noexcept
+    {
+        m_gc.setThreshold(threshold);
+    }
+
+    GCStats VM::gcStats() const noexcept
+    {
+        return m_gc.stats();
+    }
+
     // ------------------------------------------
     //                 execution
     // ------------------------------------------
@@ -180,7 +420,16 @@ namespace Ark
         using namespace Ark::internal;
 
         init();
-        safeRun();
+        if (m_profiler)
+            m_profiler->enter(0, 0xffff, m_frames.size());
+        if (m_sampler)
+            m_sampler->start();
+        runTasks();
+        if (m_sampler)
+            m_sampler->stop();
+        if (m_profiler)
+            m_profiler->leaveAll();
+        flush();
 
         // reset VM after each run
         m_ip = 0;
@@ -189,7 +438,243 @@ namespace Ark
         return m_exitCode;
     }
 
+    int VM::runIncremental() noexcept
+    {
+        using namespace Ark::internal;
+
+        try {
+            // only the first run initializes the VM, the next ones keep the global frame and scope
+            if (m_frames.empty())
+                init();
+            else
+                registerNewSymbols(m_known_symbols);
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+
+        m_pp = m_state->m_incremental_page;
+        m_ip = 0;
+
+        if (runTasks() != 0)
+        {
+            // execution failed, drop everything but the global frame and scope
+            m_frames.erase(m_frames.begin() + 1, m_frames.end());
+            m_frames.back().resetScopeCountToDelete();
+            m_locals.erase(m_locals.begin() + 1, m_locals.end());
+            m_saved_scope.reset();
+        }
+        flush();
+
+        return m_exitCode;
+    }
+
+    int VM::runTasks()
+    {
+        using namespace Ark::internal;
+
+        std::size_t main_task = m_current_task = m_next_task_id++;
+        m_tasks[main_task].status = Task::Status::Running;
+        m_can_suspend = true;
+        m_exited = false;
+
+        int status = safeRun();
+        while (status == 0 && !m_exited)
+        {
+            Task& task = m_tasks[m_current_task];
+            if (m_suspended)
+            {
+                m_suspended = false;
+                saveContext(task.context);
+            }
+            else
+            {
+                // the spawned functions leave their return value in the base frame
+                task.status = Task::Status::Finished;
+                if (m_current_task != main_task && m_frames.back().stackSize() != 0)
+                    task.result = *popVal();
+                else
+                    task.result = Builtins::nil;
+
+                // keep the variables of the main program, to give them back at the end
+                if (m_current_task == main_task)
+                    saveContext(task.context);
+
+                for (std::size_t waiting : task.awaiting)
+                    resume(waiting, task.result);
+                task.awaiting.clear();
+            }
+
+            // nothing to run: wait for the timers and I/O operations
+            while (m_ready_tasks.empty() && m_event_loop.pending())
+            {
+                for (auto& [id, result] : m_event_loop.wait())
+                    resume(id, std::move(result));
+            }
+            // every task is finished, or waiting for another one which will never finish
+            if (m_ready_tasks.empty())
+                break;
+
+            m_current_task = m_ready_tasks.front();
+            m_ready_tasks.pop_front();
+            status = runTask(m_current_task);
+        }
+
+        // give back the execution context of the main program if it was swapped
+        if (!m_tasks[main_task].context.frames.empty())
+            loadContext(std::move(m_tasks[main_task].context));
+
+        m_can_suspend = false;
+        m_suspended = false;
+        m_tasks.clear();
+        m_ready_tasks.clear();
+        m_event_loop.clear();
+
+        return status;
+    }
+
+    int VM::runTask(std::size_t task_id)
+    {
+        using namespace Ark::internal;
+
+        Task& task = m_tasks[task_id];
+        task.status = Task::Status::Running;
+
+        // resume the task where the builtin which suspended it returned
+        if (!task.context.frames.empty())
+        {
+            loadContext(std::move(task.context));
+            *peekVal() = std::move(task.result);
+            task.result = Builtins::nil;
+            return safeRun(task.base_frame_count);
+        }
+
+        // start the task in a frame of its own, with the global scope given by spawn
+        task.context.frames.emplace_back();
+        task.context.last_sym_loaded = 0xffff;  // the function wasn't loaded from a symbol
+        loadContext(std::move(task.context));
+        task.base_frame_count = 1;
+
+        for (Value& arg : task.args)
+            push(std::move(arg));
+        push(std::move(task.function));
+        task.args.clear();
+
+        try {
+            call(static_cast<int16_t>(m_frames.back().stackSize() - 1));
+        } catch (const std::exception& e) {
+            flush();
+            std::cerr << e.what() << "\n";
+            backtrace();
+            return 1;
+        }
+        // call() left the instruction pointer at -1, expecting the loop to increment it
+        m_ip = 0;
+
+        return safeRun(task.base_frame_count);
+    }
+
+    void VM::saveContext(internal::ExecutionContext& context) noexcept
+    {
+        context.frames = std::move(m_frames);
+        context.locals = std::move(m_locals);
+        context.saved_scope = std::move(m_saved_scope);
+        context.ip = m_ip;
+        context.pp = m_pp;
+        context.last_sym_loaded = m_last_sym_loaded;
+
+        m_frames.clear();
+        m_locals.clear();
+        m_saved_scope.reset();
+    }
+
+    void VM::loadContext(internal::ExecutionContext&& context) noexcept
+    {
+        m_frames = std::move(context.frames);
+        m_locals = std::move(context.locals);
+        m_saved_scope = std::move(context.saved_scope);
+        m_ip = context.ip;
+        m_pp = context.pp;
+        m_last_sym_loaded = context.last_sym_loaded;
+
+        context.frames.clear();
+        context.locals.clear();
+        context.saved_scope.reset();
+    }
+
+    std::size_t VM::spawn(const internal::Value& function, std::vector<internal::Value> args)
+    {
+        using namespace Ark::internal;
+
+        if (m_tasks.empty())
+            throw std::runtime_error("Can't spawn a task: the VM isn't running");
+
+        std::size_t id = m_next_task_id++;
+        Task& task = m_tasks[id];
+        task.function = function;
+        task.args = std::move(args);
+        task.context.locals.push_back(m_locals[0]);
+        m_ready_tasks.push_back(id);
+        return id;
+    }
+
+    std::size_t VM::suspend()
+    {
+        using namespace Ark::internal;
+
+        if (!m_can_suspend)
+            throw std::runtime_error("Can't suspend the execution: the VM isn't running, or the code was called from C++");
+
+        m_tasks[m_current_task].status = Task::Status::Suspended;
+        m_suspended = true;
+        m_running = false;
+        return m_current_task;
+    }
+
+    void VM::resume(std::size_t task_id, internal::Value result)
+    {
+        using namespace Ark::internal;
+
+        // the task may have been dropped by a previous run
+        auto it = m_tasks.find(task_id);
+        if (it == m_tasks.end() || it->second.status != Task::Status::Suspended)
+            return;
+
+        it->second.status = Task::Status::Ready;
+        it->second.result = std::move(result);
+        m_ready_tasks.push_back(task_id);
+    }
+
+    internal::Value VM::await(std::size_t task_id)
+    {
+        using namespace Ark::internal;
+
+        auto it = m_tasks.find(task_id);
+        if (it == m_tasks.end())
+            throw std::runtime_error("Can't await task " + Utils::toString(task_id) + ": it doesn't exist");
+        if (it->second.status == Task::Status::Finished)
+            return it->second.result;
+        if (task_id == m_current_task)
+            throw std::runtime_error("A task can't await itself");
+
+        it->second.awaiting.push_back(suspend());
+        return Builtins::nil;
+    }
+
+    internal::EventLoop& VM::eventLoop() noexcept
+    {
+        return m_event_loop;
+    }
+
     int VM::safeRun(std::size_t untilFrameCount)
+    {
+        if (m_profiler || m_sampler)
+            return safeRunImpl<true>(untilFrameCount);
+        return safeRunImpl<false>(untilFrameCount);
+    }
+
+    template <bool Profiling>
+    int VM::safeRunImpl(std::size_t untilFrameCount)
     {
         using namespace Ark::internal;
         m_until_frame_count = untilFrameCount;
@@ -200,6 +685,13 @@ namespace Ark
             {
                 // get current instruction
                 uint8_t inst = m_state->m_pages[m_pp][m_ip];
+                if constexpr (Profiling)
+                {
+                    if (m_profiler)
+                        m_profiler->instruction(inst, m_pp);
+                    if (m_sampler && m_sampler->requested())
+                        m_sampler->sample(m_frames, m_ip);
+                }
 
                 // and it's time to du-du-du-du-duel!
                 switch (inst)
@@ -215,7 +707,13 @@ namespace Ark
                         readNumber(m_last_sym_loaded);
 
                         if (Value* var = findNearestVariable(m_last_sym_loaded); var != nullptr)
+                        {
+                            // the variable and the value loaded share the elements of a list, until one of them is modified.
+                            // A copy of the VM running on another thread doesn't modify the variables, see fork
+                            if (var->valueType() == ValueType::List && !m_forked)
+                                var->shareList();
                             push(*var);
+                        }
                         else
                             throwVMError("unbound variable: " + m_state->m_symbols[m_last_sym_loaded]);
                         break;
@@ -235,7 +733,12 @@ namespace Ark
                         if (m_saved_scope && m_state->m_constants[id].valueType() == ValueType::PageAddr)
                         {
                             push(Value(Closure(m_saved_scope.value(), m_state->m_constants[id].pageAddr())));
+                            m_gc.track(m_saved_scope.value());
                             m_saved_scope.reset();
+                            m_memory.closures_created++;
+
+                            if (m_gc.shouldCollect())
+                                m_gc.collect();
                         }
                         else
                             push(m_state->m_constants[id]);
@@ -274,7 +777,10 @@ namespace Ark
                         {
                             if (var->isConst())
                                 throwVMError("can not modify a constant: " + m_state->m_symbols[id]);
-                            *var = *popVal();
+                            Value* val = popVal();
+                            if (val->isConst())
+                                unshareObject(*val);
+                            *var = std::move(*val);
                             var->setConst(false);
                             break;
                         }
@@ -299,6 +805,10 @@ namespace Ark
                             throwVMError("can not use 'let' to redefine the variable " + m_state->m_symbols[id]);
 
                         Value* val = popVal();
+                        // a dictionary or a range is shared by its copies, the constant must not see the changes made through them
+                        if ((val->valueType() == ValueType::Dict && std::get<std::shared_ptr<Dict>>(val->m_value).use_count() > 1) ||
+                            (val->valueType() == ValueType::Range && std::get<std::shared_ptr<Range>>(val->m_value).use_count() > 1))
+                            unshareObject(*val);
                         val->setConst(true);
                         registerVariable(id, *val);
                         break;
@@ -348,6 +858,11 @@ namespace Ark
                         m_ip = static_cast<int>(m_frames.back().callerAddr());
 
                         Value return_value = m_frames.back().stackSize() != 0 ? *popVal() : Builtins::nil;
+                        if constexpr (Profiling)
+                        {
+                            if (m_profiler)
+                                m_profiler->leave(m_frames.size());
+                        }
                         returnFromFuncCall();
                         push(return_value);
                         break;
@@ -358,8 +873,20 @@ namespace Ark
                         break;
 
                     case Instruction::CALL:
-                        call();
+                    {
+                        if constexpr (Profiling)
+                        {
+                            // builtins don't create a frame, only the functions are timed
+                            std::size_t frames_count = m_frames.size();
+                            uint16_t symbol_id = m_last_sym_loaded;
+                            call();
+                            if (m_profiler && m_frames.size() > frames_count)
+                                m_profiler->enter(m_pp, symbol_id, m_frames.size());
+                        }
+                        else
+                            call();
                         break;
+                    }
 
                     case Instruction::CAPTURE:
                     {
@@ -406,6 +933,8 @@ namespace Ark
                         uint16_t id; readNumber(id);
 
                         Value* val = popVal();
+                        if (val->isConst())
+                            unshareObject(*val);
                         val->setConst(false);
                         registerVariable(id, *val);
                         break;
@@ -456,7 +985,12 @@ namespace Ark
                         if (var->valueType() != ValueType::Closure)
                             throwVMError("the variable `" + m_state->m_symbols[m_last_sym_loaded] + "' isn't a closure, can not get the field `" + m_state->m_symbols[id] + "' from it");
 
-                        if (Value* field = (*var->closure_ref().scope())[id]; field != nullptr)
+                        if (m_pp >= m_field_cache.size())
+                            m_field_cache.resize(m_state->m_pages.size());
+                        if (m_field_cache[m_pp].empty())
+                            m_field_cache[m_pp].resize(m_state->m_pages[m_pp].size(), 0);
+
+                        if (Value* field = var->closure_ref().scope()->lookupCached(id, m_field_cache[m_pp][m_ip]); field != nullptr)
                         {
                             // check for CALL instruction
                             if (m_ip + 1 < m_state->m_pages[m_pp].size() && m_state->m_pages[m_pp][m_ip + 1] == Instruction::CALL)
@@ -465,6 +999,8 @@ namespace Ark
                                 m_frames.back().incScopeCountToDelete();
                             }
 
+                            if (field->valueType() == ValueType::List && !m_forked)
+                                field->shareList();
                             push(*field);
                             break;
                         }
@@ -516,12 +1052,13 @@ namespace Ark
                         Value *list = popVal();
                         if (list->valueType() != ValueType::List)
                             throw Ark::TypeError("append needs a list and then whatever you want");
-                        const uint16_t size = list->const_list().size();
-                        list->list().reserve(size + count);
+                        std::vector<Value>& elements = list->list();
+                        elements.reserve(elements.size() + count);
 
+                        // the popped values aren't used anymore, they can be moved
                         for (uint16_t i=0; i < count; ++i)
-                            list->push_back(*popVal());
-                        push(*list);
+                            list->push_back(std::move(*popVal()));
+                        push(std::move(*list));
 
                         break;
                     }
@@ -541,17 +1078,117 @@ namespace Ark
                             if (next->valueType() != ValueType::List)
                                 throw Ark::TypeError("concat needs lists");
 
-                            for (auto it=next->list().begin(), end=next->list().end(); it != end; ++it)
-                                list->push_back(*it);
+                            // read in place, a view over a list doesn't have to be copied into its own vector first
+                            std::vector<Value>& elements = list->list();
+                            elements.insert(elements.end(), next->listData(), next->listData() + next->listSize());
                         }
-                        push(*list);
+                        push(std::move(*list));
+
+                        break;
+                    }
+
+                    case Instruction::APPEND_IN_PLACE:
+                    {
+                        /*
+                            Argument: symbol id (two bytes, big endian)
+                            Job: Take the value on top of the stack and append it to the list held by the variable
+                                    named following the symbol id, without copying the list
+                        */
+                        ++m_ip;
+                        uint16_t id; readNumber(id);
+
+                        Value* list = findListToModify(id, "append!");
+                        list->push_back(std::move(*popVal()));
+
+                        break;
+                    }
+
+                    case Instruction::CONCAT_IN_PLACE:
+                    {
+                        /*
+                            Argument: symbol id (two bytes, big endian)
+                            Job: Take the list on top of the stack and add its elements at the end of the list
+                                    held by the variable named following the symbol id, without copying the latter
+                        */
+                        ++m_ip;
+                        uint16_t id; readNumber(id);
+
+                        Value* list = findListToModify(id, "concat!");
+                        Value* next = popVal();
+                        if (next->valueType() != ValueType::List)
+                            throw Ark::TypeError("concat! needs lists");
+
+                        // read in place, a view over a list doesn't have to be copied into its own vector first
+                        std::vector<Value>& elements = list->list();
+                        elements.insert(elements.end(), next->listData(), next->listData() + next->listSize());
+
+                        break;
+                    }
+
+                    case Instruction::SET_AT_IN_PLACE:
+                    {
+                        /*
+                            Argument: symbol id (two bytes, big endian)
+                            Job: Take an index and a value from the stack, and replace the element at this index in
+                                    the list held by the variable named following the symbol id
+                        */
+                        ++m_ip;
+                        uint16_t id; readNumber(id);
+
+                        Value* list = findListToModify(id, "list:setAt!");
+                        Value* index = popVal();
+                        if (index->valueType() != ValueType::Number)
+                            throw Ark::TypeError("list:setAt!: index must be a Number");
+
+                        long idx = static_cast<long>(index->number());
+                        std::vector<Value>& elements = list->list();
+                        long size = static_cast<long>(elements.size());
+                        if (idx < -size || idx >= size)
+                            throw std::runtime_error("list:setAt!: index out of range");
+
+                        elements[idx < 0 ? size + idx : idx] = std::move(*popVal());
+
+                        break;
+                    }
+
+                    case Instruction::ERASE_IN_PLACE:
+                    {
+                        /*
+                            Argument: symbol id (two bytes, big endian)
+                            Job: Take an index from the stack, and remove the element at this index in the list
+                                    held by the variable named following the symbol id
+                        */
+                        ++m_ip;
+                        uint16_t id; readNumber(id);
+
+                        Value* list = findListToModify(id, "list:removeAt!");
+                        Value* index = popVal();
+                        if (index->valueType() != ValueType::Number)
+                            throw Ark::TypeError("list:removeAt!: index must be a Number");
+
+                        long idx = static_cast<long>(index->number());
+                        std::vector<Value>& elements = list->list();
+                        long size = static_cast<long>(elements.size());
+                        if (idx < -size || idx >= size)
+                            throw std::runtime_error("list:removeAt!: index out of range");
+
+                        elements.erase(elements.begin() + (idx < 0 ? size + idx : idx));
 
                         break;
                     }
 
                     case Instruction::ADD:
                     {
-                        Value *b = popVal(), *a = popVal();
+                        Value *b = popVal(), *a = peekVal();
+                        // numbers fast path: the result replaces a on the stack
+                        if (a->valueType() == ValueType::Number && b->valueType() == ValueType::Number)
+                        {
+                            a->number_ref() += b->number_ref();
+                            a->setConst(false);
+                            break;
+                        }
+
+                        popVal();
                         if (a->valueType() == ValueType::Number)
                         {
                             if (b->valueType() != ValueType::Number)
@@ -573,76 +1210,127 @@ namespace Ark
 
                     case Instruction::SUB:
                     {
-                        Value *b = popVal(), *a = popVal();
+                        Value *b = popVal(), *a = peekVal();
                         if (a->valueType() != ValueType::Number || b->valueType() != ValueType::Number)
                             throw Ark::TypeError("Arguments of - should be Numbers");
 
-                        push(Value(a->number() - b->number()));
+                        a->number_ref() -= b->number_ref();
+                        a->setConst(false);
                         break;
                     }
 
                     case Instruction::MUL:
                     {
-                        Value *b = popVal(), *a = popVal();
+                        Value *b = popVal(), *a = peekVal();
                         if (a->valueType() != ValueType::Number || b->valueType() != ValueType::Number)
                             throw Ark::TypeError("Arguments of * should be Numbers");
 
-                        push(Value(a->number() * b->number()));
+                        a->number_ref() *= b->number_ref();
+                        a->setConst(false);
                         break;
                     }
 
                     case Instruction::DIV:
                     {
-                        Value *b = popVal(), *a = popVal();
+                        Value *b = popVal(), *a = peekVal();
                         if (a->valueType() != ValueType::Number || b->valueType() != ValueType::Number)
                             throw Ark::TypeError("Arguments of / should be Numbers");
 
-                        auto d = b->number();
+                        auto d = b->number_ref();
                         if (d == 0)
                             throw Ark::ZeroDivisionError();
 
-                        push(Value(a->number() / d));
+                        a->number_ref() /= d;
+                        a->setConst(false);
                         break;
                     }
 
                     case Instruction::GT:
                     {
-                        Value *b = popVal(), *a = popVal();
+                        Value *b = popVal(), *a = peekVal();
+                        if (a->valueType() == ValueType::Number && b->valueType() == ValueType::Number)
+                        {
+                            double x = a->number_ref(), y = b->number_ref();
+                            a->setBool(!(x == y) && !(x < y));
+                            break;
+                        }
+
+                        popVal();
                         push((!(*a == *b) && !(*a < *b)) ? Builtins::trueSym : Builtins::falseSym);
                         break;
                     }
 
                     case Instruction::LT:
                     {
-                        Value *b = popVal(), *a = popVal();
+                        Value *b = popVal(), *a = peekVal();
+                        if (a->valueType() == ValueType::Number && b->valueType() == ValueType::Number)
+                        {
+                            double x = a->number_ref(), y = b->number_ref();
+                            a->setBool(x < y);
+                            break;
+                        }
+
+                        popVal();
                         push((*a < *b) ? Builtins::trueSym : Builtins::falseSym);
                         break;
                     }
 
                     case Instruction::LE:
                     {
-                        Value *b = popVal(), *a = popVal();
+                        Value *b = popVal(), *a = peekVal();
+                        if (a->valueType() == ValueType::Number && b->valueType() == ValueType::Number)
+                        {
+                            double x = a->number_ref(), y = b->number_ref();
+                            a->setBool((x < y) || (x == y));
+                            break;
+                        }
+
+                        popVal();
                         push(((*a < *b) || (*a == *b)) ? Builtins::trueSym : Builtins::falseSym);
                         break;
                     }
 
                     case Instruction::GE:
                     {
-                        Value *b = popVal(), *a = popVal();
+                        Value *b = popVal(), *a = peekVal();
+                        if (a->valueType() == ValueType::Number && b->valueType() == ValueType::Number)
+                        {
+                            double x = a->number_ref(), y = b->number_ref();
+                            a->setBool(!(x < y));
+                            break;
+                        }
+
+                        popVal();
                         push(!(*a < *b) ? Builtins::trueSym : Builtins::falseSym);
                         break;
                     }
 
                     case Instruction::NEQ:
                     {
-                        Value *b = popVal(), *a = popVal();
+                        Value *b = popVal(), *a = peekVal();
+                        if (a->valueType() == ValueType::Number && b->valueType() == ValueType::Number)
+                        {
+                            double x = a->number_ref(), y = b->number_ref();
+                            a->setBool(x != y);
+                            break;
+                        }
+
+                        popVal();
                         push((*a != *b) ? Builtins::trueSym : Builtins::falseSym);
                         break;
                     }
 
                     case Instruction::EQ:
                     {
-                        Value *b = popVal(), *a = popVal();
+                        Value *b = popVal(), *a = peekVal();
+                        if (a->valueType() == ValueType::Number && b->valueType() == ValueType::Number)
+                        {
+                            double x = a->number_ref(), y = b->number_ref();
+                            a->setBool(x == y);
+                            break;
+                        }
+
+                        popVal();
                         push((*a == *b) ? Builtins::trueSym : Builtins::falseSym);
                         break;
                     }
@@ -651,11 +1339,17 @@ namespace Ark
                     {
                         Value *a = popVal();
                         if (a->valueType() == ValueType::List)
-                            push(Value(static_cast<int>(a->const_list().size())));
+                            push(Value(static_cast<int>(a->listSize())));
                         else if (a->valueType() == ValueType::String)
                             push(Value(static_cast<int>(a->string().size())));
+                        else if (a->valueType() == ValueType::Dict)
+                            push(Value(static_cast<int>(a->const_dict().size())));
+                        else if (a->valueType() == ValueType::Array)
+                            push(Value(static_cast<int>(a->const_array().size())));
+                        else if (a->valueType() == ValueType::Range)
+                            push(Value(static_cast<int>(a->const_range().size())));
                         else
-                            throw Ark::TypeError("Argument of len must be a list or a String");
+                            throw Ark::TypeError("Argument of len must be a list, a String, a Dict, an Array or a Range");
                         break;
                     }
 
@@ -663,22 +1357,32 @@ namespace Ark
                     {
                         Value* a = popVal();
                         if (a->valueType() == ValueType::List)
-                            push((a->const_list().size() == 0) ? Builtins::trueSym : Builtins::falseSym);
+                            push((a->listSize() == 0) ? Builtins::trueSym : Builtins::falseSym);
                         else if (a->valueType() == ValueType::String)
                             push((a->string().size() == 0) ? Builtins::trueSym : Builtins::falseSym);
+                        else if (a->valueType() == ValueType::Dict)
+                            push((a->const_dict().size() == 0) ? Builtins::trueSym : Builtins::falseSym);
+                        else if (a->valueType() == ValueType::Array)
+                            push(a->const_array().empty() ? Builtins::trueSym : Builtins::falseSym);
+                        else if (a->valueType() == ValueType::Range)
+                            push((a->const_range().size() == 0) ? Builtins::trueSym : Builtins::falseSym);
                         else
-                            throw Ark::TypeError("Argument of empty? must be a list or a String");
+                            throw Ark::TypeError("Argument of empty? must be a list, a String, a Dict, an Array or a Range");
 
                         break;
                     }
 
                     case Instruction::FIRSTOF:
                     {
-                        Value a = *popVal();
-                        if (a.valueType() == ValueType::List)
-                            push(a.const_list().size() > 0 ? (a.const_list())[0] : Value(ValueType::List));
-                        else if (a.valueType() == ValueType::String)
-                            push(a.string().size() > 0 ? Value(std::string(1, (a.string())[0])) : Value(ValueType::String));
+                        Value* a = popVal();
+                        if (a->valueType() == ValueType::List)
+                        {
+                            // copy the element before pushing, the slot of a is reused
+                            Value first = a->listSize() > 0 ? a->listData()[0] : Value(ValueType::List);
+                            push(std::move(first));
+                        }
+                        else if (a->valueType() == ValueType::String)
+                            push(a->string().size() > 0 ? Value(std::string(1, (a->string())[0])) : Value(ValueType::String));
                         else
                             throw Ark::TypeError("Argument of firstOf must be a list");
 
@@ -690,14 +1394,15 @@ namespace Ark
                         Value* a = popVal();
                         if (a->valueType() == ValueType::List)
                         {
-                            if (a->const_list().size() < 2)
+                            if (a->listSize() < 2)
                             {
                                 push(Value(ValueType::List));
                                 break;
                             }
 
-                            a->list().erase(a->const_list().begin());
-                            push(*a);
+                            // a view over the elements of a, instead of a copy
+                            Value tail = a->sliceList(1, a->listSize() - 1);
+                            push(std::move(tail));
                         }
                         else if (a->valueType() == ValueType::String)
                         {
@@ -721,14 +1426,14 @@ namespace Ark
                         Value* a = popVal();
                         if (a->valueType() == ValueType::List)
                         {
-                            if (a->const_list().size() < 2)
+                            if (a->listSize() < 2)
                             {
                                 push(Value(ValueType::List));
                                 break;
                             }
 
-                            a->list().pop_back();
-                            push(*a);
+                            Value head = a->sliceList(0, a->listSize() - 1);
+                            push(std::move(head));
                         }
                         else if (a->valueType() == ValueType::String)
                         {
@@ -782,6 +1487,20 @@ namespace Ark
 
                     case Instruction::TO_STR:
                     {
+                        // a String is already converted
+                        if (Value* a = peekVal(); a->valueType() == ValueType::String)
+                        {
+                            a->setConst(false);
+                            break;
+                        }
+                        // skip the stringstream for the most common case
+                        else if (a->valueType() == ValueType::Number)
+                        {
+                            char buffer[Utils::NumberBufferSize];
+                            *a = Value(std::string(Utils::formatNumber(a->number(), buffer)));
+                            break;
+                        }
+
                         std::stringstream ss;
                         ss << (*popVal());
                         push(Value(ss.str()));
@@ -790,18 +1509,39 @@ namespace Ark
 
                     case Instruction::AT:
                     {
-                        Value *b = popVal(), a = *popVal();
+                        Value *b = popVal(), *a = popVal();
                         if (b->valueType() != ValueType::Number)
                             throw Ark::TypeError("Argument 2 of @ should be a Number");
 
+                        long size;
+                        if (a->valueType() == ValueType::List)
+                            size = static_cast<long>(a->listSize());
+                        else if (a->valueType() == ValueType::String)
+                            size = static_cast<long>(a->string().size());
+                        else if (a->valueType() == ValueType::Array)
+                            size = static_cast<long>(a->const_array().size());
+                        else if (a->valueType() == ValueType::Range)
+                            size = static_cast<long>(a->const_range().size());
+                        else
+                            throw Ark::TypeError("Argument 1 of @ should be a List, a String, an Array or a Range");
+
                         long idx = static_cast<long>(b->number());
+                        if (idx < 0)
+                            idx += size;
+                        if (idx < 0 || idx >= size)
+                            throw std::runtime_error("@: index out of range");
 
-                        if (a.valueType() == ValueType::List)
-                            push(a.list()[idx < 0 ? a.list().size() + idx : idx]);
-                        else if (a.valueType() == ValueType::String)
-                            push(Value(std::string(1, a.string()[idx < 0 ? a.string().size() + idx : idx])));
+                        // copy the element before pushing, the slot of a is reused
+                        Value element;
+                        if (a->valueType() == ValueType::List)
+                            element = a->listData()[idx];
+                        else if (a->valueType() == ValueType::String)
+                            element = Value(std::string(1, a->string()[idx]));
+                        else if (a->valueType() == ValueType::Array)
+                            element = Value(a->const_array()[idx]);
                         else
-                            throw Ark::TypeError("Argument 1 of @ should be a List or a String");
+                            element = Value(a->const_range().at(idx));
+                        push(std::move(element));
                         break;
                     }
 
@@ -821,13 +1561,14 @@ namespace Ark
 
                     case Instruction::MOD:
                     {
-                        Value *b = popVal(), *a = popVal();
+                        Value *b = popVal(), *a = peekVal();
                         if (a->valueType() != ValueType::Number)
                             throw Ark::TypeError("Arguments of mod should be Numbers");
                         if (b->valueType() != ValueType::Number)
                             throw Ark::TypeError("Arguments of mod should be Numbers");
 
-                        push(Value(std::fmod(a->number(), b->number())));
+                        a->number_ref() = std::fmod(a->number_ref(), b->number_ref());
+                        a->setConst(false);
                         break;
                     }
 
@@ -846,15 +1587,14 @@ namespace Ark
                         if (field->valueType() != ValueType::String)
                             throw Ark::TypeError("Argument no 2 of hasField should be a String");
 
-                        auto it = std::find(m_state->m_symbols.begin(), m_state->m_symbols.end(), field->string_ref().toString());
-                        if (it == m_state->m_symbols.end())
+                        auto it = m_state->m_symbols_ids.find(field->string_ref().toString());
+                        if (it == m_state->m_symbols_ids.end())
                         {
                             push(Builtins::falseSym);
                             break;
                         }
 
-                        uint16_t id = static_cast<uint16_t>(std::distance(m_state->m_symbols.begin(), it));
-                        push((*closure->closure_ref().scope_ref())[id] != nullptr ? Builtins::trueSym : Builtins::falseSym);
+                        push((*closure->closure_ref().scope_ref())[it->second] != nullptr ? Builtins::trueSym : Builtins::falseSym);
 
                         break;
                     }
@@ -878,10 +1618,17 @@ namespace Ark
                 ++m_ip;
             }
         } catch (const std::exception& e) {
+            // let the VM which created this one report the error
+            if (m_forked)
+                throw;
+            flush();
             std::cerr << e.what() << "\n";
             backtrace();
             return 1;
         } catch (...) {
+            if (m_forked)
+                throw;
+            flush();
             std::cerr << "Unknown error" << std::endl;
             backtrace();
             return 1;
@@ -908,6 +1655,147 @@ namespace Ark
         throw std::runtime_error(message);
     }
 
+    void VM::accountValue(const internal::Value& value, MemoryStats& stats, std::unordered_set<const void*>& visited) const
+    {
+        using namespace Ark::internal;
+
+        stats.values++;
+        switch (value.valueType())
+        {
+            case ValueType::String:
+                stats.string_bytes += value.string().size();
+                break;
+
+            case ValueType::List:
+                // a slice shares the buffer of the list it was taken from, count it only once
+                if (std::holds_alternative<ListSlice>(value.m_value))
+                {
+                    const ListSlice& slice = std::get<ListSlice>(value.m_value);
+                    if (!visited.insert(slice.buffer.get()).second)
+                        break;
+                    stats.list_bytes += slice.buffer->capacity() * sizeof(Value);
+                    for (const Value& elem : *slice.buffer)
+                        accountValue(elem, stats, visited);
+                    break;
+                }
+
+                stats.list_bytes += std::get<std::vector<Value>>(value.m_value).capacity() * sizeof(Value);
+                for (const Value& elem : std::get<std::vector<Value>>(value.m_value))
+                    accountValue(elem, stats, visited);
+                break;
+
+            case ValueType::Array:
+                // the numbers are shared by the copies of the array
+                if (visited.insert(&value.const_array()).second)
+                    stats.list_bytes += value.const_array().capacity() * sizeof(double);
+                break;
+
+            case ValueType::Closure:
+                stats.closures++;
+                accountScope(value.closure().scope().get(), stats, visited);
+                break;
+
+            case ValueType::Dict:
+                // a dictionary is shared by its copies, and its entries by the copies of the dictionary itself, count them only once
+                if (!visited.insert(&value.const_dict()).second)
+                    break;
+                stats.list_bytes += sizeof(Dict);
+                if (!visited.insert(value.const_dict().entries()).second)
+                    break;
+                stats.list_bytes += value.const_dict().reservedBytes();
+                value.const_dict().forEach([&](const Value& key, const Value& elem) {
+                    accountValue(key, stats, visited);
+                    accountValue(elem, stats, visited);
+                });
+                break;
+
+            case ValueType::Range:
+                // shared by its copies as well
+                if (visited.insert(&value.const_range()).second)
+                    stats.list_bytes += sizeof(Range);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    void VM::accountScope(const internal::Scope* scope, MemoryStats& stats, std::unordered_set<const void*>& visited) const
+    {
+        using namespace Ark::internal;
+
+        // scopes are shared between the VM and the closures, count them only once
+        if (!visited.insert(scope).second)
+            return;
+
+        stats.scopes++;
+        stats.scope_bytes += sizeof(Scope) + scope->m_data.capacity() * sizeof(std::pair<uint16_t, Value>);
+        for (const auto& [id, value] : scope->m_data)
+            accountValue(value, stats, visited);
+    }
+
+    internal::Value VM::isolate(const internal::Value& value)
+    {
+        std::unordered_map<const internal::Scope*, internal::Scope_t> scopes;
+        return isolateValue(value, scopes);
+    }
+
+    internal::Value VM::isolateValue(const internal::Value& value, std::unordered_map<const internal::Scope*, internal::Scope_t>& scopes)
+    {
+        using namespace Ark::internal;
+
+        switch (value.valueType())
+        {
+            case ValueType::List:
+            {
+                std::vector<Value> elements;
+                elements.reserve(value.listSize());
+                for (const Value* elem = value.listData(), *end = elem + value.listSize(); elem != end; ++elem)
+                    elements.push_back(isolateValue(*elem, scopes));
+                return Value(std::move(elements));
+            }
+
+            case ValueType::Dict:
+            {
+                // the keys are numbers or strings, only the values can share something
+                auto dict = std::make_shared<Dict>();
+                m_gc.track(dict);
+                std::vector<Value> keys = value.const_dict().keys();
+                for (const Value& key : keys)
+                    dict->set(key, isolateValue(*value.const_dict().find(key), scopes));
+                Value output(std::move(dict));
+                output.setConst(value.isConst());
+                return output;
+            }
+
+            case ValueType::Range:
+            {
+                Value output(std::make_shared<Range>(value.const_range()));
+                output.setConst(value.isConst());
+                return output;
+            }
+
+            case ValueType::Closure:
+            {
+                const Scope* scope = value.closure().scope().get();
+                // the closures created in the same environment keep sharing it, and a closure captured by itself doesn't loop
+                if (auto it = scopes.find(scope); it != scopes.end())
+                    return Value(Closure(it->second, value.closure().pageAddr()));
+
+                Scope_t copy = std::make_shared<Scope>();
+                m_gc.track(copy);
+                scopes.emplace(scope, copy);
+                copy->reserve(scope->m_data.size());
+                for (const auto& [id, captured] : scope->m_data)
+                    copy->push_back(id, isolateValue(captured, scopes));
+                return Value(Closure(std::move(copy), value.closure().pageAddr()));
+            }
+
+            default:
+                return value;
+        }
+    }
+
     void VM::backtrace() noexcept
     {
         using namespace Ark::internal;
@@ -0,0 +1,62 @@
+#include <Ark/VM/VMPool.hpp>
+
+namespace Ark
+{
+    void VMPool::Releaser::operator()(VM* vm) const noexcept
+    {
+        pool->release(vm);
+    }
+
+    VMPool::VMPool(const State& state, std::size_t preallocated) :
+        m_state(state)
+    {
+        m_available.reserve(preallocated);
+        for (std::size_t i = 0; i < preallocated; ++i)
+        {
+            m_available.emplace_back(std::make_unique<VM>(&m_state));
+            m_available.back()->init();
+        }
+    }
+
+    VMPool::Lease VMPool::acquire()
+    {
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_available.empty())
+            {
+                VM* vm = m_available.back().release();
+                m_available.pop_back();
+                return Lease(vm, Releaser { this });
+            }
+        }
+
+        auto vm = std::make_unique<VM>(&m_state);
+        vm->init();
+        return Lease(vm.release(), Releaser { this });
+    }
+
+    std::size_t VMPool::available() const
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        return m_available.size();
+    }
+
+    void VMPool::release(VM* vm) noexcept
+    {
+        std::unique_ptr<VM> owned(vm);
+        try
+        {
+            // free the data of the previous run outside of the lock, keeping the plugins loaded
+            owned->init();
+        }
+        catch (...)
+        {
+            // a VM which couldn't be cleaned isn't given again, the next acquire creates a new one
+            return;
+        }
+        owned->m_user_pointer = nullptr;
+
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_available.push_back(std::move(owned));
+    }
+}
@@ -1,6 +1,10 @@
 #include <Ark/VM/Value.hpp>
 
+#include <algorithm>
+
 #include <Ark/VM/Frame.hpp>
+#include <Ark/VM/Dict.hpp>
+#include <Ark/VM/Range.hpp>
 #include <Ark/Utils.hpp>
 
 #define init_const_type(is_const, type) ((is_const ? (1 << 7) : 0) | static_cast<uint8_t>(type))
@@ -20,6 +24,10 @@ namespace Ark::internal
             m_value = std::vector<Value>();
         else if (type == ValueType::String)
             m_value = "";
+        else if (type == ValueType::Dict)
+            m_value = std::make_shared<Dict>();
+        else if (type == ValueType::Array)
+            m_value = std::make_shared<std::vector<double>>();
     }
 
     Value::Value(int value) noexcept :
@@ -54,6 +62,10 @@ namespace Ark::internal
         m_value(value), m_constType(init_const_type(false, ValueType::CProc))
     {}
 
+    Value::Value(Value::FastProcType value) noexcept :
+        m_value(value), m_constType(init_const_type(false, ValueType::CProc))
+    {}
+
     Value::Value(std::vector<Value>&& value) noexcept :
         m_value(value), m_constType(init_const_type(false, ValueType::List))
     {}
@@ -66,10 +78,28 @@ namespace Ark::internal
         m_value(value), m_constType(init_const_type(false, ValueType::User))
     {}
 
+    Value::Value(std::shared_ptr<Dict> value) noexcept :
+        m_value(std::move(value)), m_constType(init_const_type(false, ValueType::Dict))
+    {}
+
+    Value::Value(std::vector<double>&& value) :
+        m_value(std::make_shared<std::vector<double>>(std::move(value))), m_constType(init_const_type(false, ValueType::Array))
+    {}
+
+    Value::Value(std::shared_ptr<Range> value) noexcept :
+        m_value(std::move(value)), m_constType(init_const_type(false, ValueType::Range))
+    {}
+
+    Value::Value(ListSlice&& value) noexcept :
+        m_value(std::move(value)), m_constType(init_const_type(false, ValueType::List))
+    {}
+
     // --------------------------
 
     std::vector<Value>& Value::list()
     {
+        if (std::holds_alternative<ListSlice>(m_value))
+            unshareList();
         return std::get<std::vector<Value>>(m_value);
     }
 
@@ -88,6 +118,79 @@ namespace Ark::internal
         return std::get<UserType>(m_value);
     }
 
+    Dict& Value::dict()
+    {
+        return *std::get<std::shared_ptr<Dict>>(m_value);
+    }
+
+    std::vector<double>& Value::array()
+    {
+        std::shared_ptr<std::vector<double>>& numbers = std::get<std::shared_ptr<std::vector<double>>>(m_value);
+        if (numbers.use_count() > 1)
+            numbers = std::make_shared<std::vector<double>>(*numbers);
+        return *numbers;
+    }
+
+    Range& Value::range()
+    {
+        return *std::get<std::shared_ptr<Range>>(m_value);
+    }
+
+    // --------------------------
+
+    Value Value::sliceList(std::size_t offset, std::size_t size)
+    {
+        shareList();
+
+        const ListSlice& slice = std::get<ListSlice>(m_value);
+        return Value(ListSlice { slice.buffer, slice.offset + static_cast<uint32_t>(offset), static_cast<uint32_t>(size) });
+    }
+
+    void Value::shareList()
+    {
+        if (std::vector<Value>* vec = std::get_if<std::vector<Value>>(&m_value))
+        {
+            const uint32_t total = static_cast<uint32_t>(vec->size());
+            m_value = ListSlice { std::make_shared<std::vector<Value>>(std::move(*vec)), 0, total };
+        }
+    }
+
+    void Value::unshareList()
+    {
+        ListSlice slice = std::move(std::get<ListSlice>(m_value));
+        std::vector<Value>& buffer = *slice.buffer;
+
+        // this value was the last one using the buffer, it takes it back without copying the elements it views
+        if (slice.buffer.use_count() == 1)
+        {
+            buffer.erase(buffer.begin() + slice.offset + slice.size, buffer.end());
+            buffer.erase(buffer.begin(), buffer.begin() + slice.offset);
+            m_value = std::move(buffer);
+        }
+        else
+            m_value = std::vector<Value>(buffer.begin() + slice.offset, buffer.begin() + slice.offset + slice.size);
+    }
+
+    bool Value::holdsPartialView() const noexcept
+    {
+        if (valueType() != ValueType::List)
+            return false;
+        if (const ListSlice* slice = std::get_if<ListSlice>(&m_value); slice != nullptr && (slice->offset != 0 || slice->size != slice->buffer->size()))
+            return true;
+        return std::any_of(listData(), listData() + listSize(), [](const Value& element) { return element.holdsPartialView(); });
+    }
+
+    void Value::unshareLists()
+    {
+        if (!holdsPartialView())
+            return;
+
+        if (std::holds_alternative<ListSlice>(m_value))
+            unshareList();
+        for (Value& element : std::get<std::vector<Value>>(m_value))
+            element.unshareLists();
+    }
+
     // --------------------------
 
     void Value::push_back(const Value& value)
@@ -97,7 +200,7 @@ namespace Ark::internal
 
     void Value::push_back(Value&& value)
     {
-        list().push_back(value);
+        list().push_back(std::move(value));
     }
 
     // --------------------------
@@ -108,9 +211,9 @@ namespace Ark::internal
         {
         case ValueType::Number:
         {
-            double d = V.number();
-            os.precision(Utils::dig_places(d) + Utils::dec_places(d));
-            os << d;
+            char buffer[Utils::NumberBufferSize];
+            std::string_view str = Utils::formatNumber(V.number(), buffer);
+            os.write(str.data(), static_cast<std::streamsize>(str.size()));
             break;
         }
 
@@ -129,7 +232,7 @@ namespace Ark::internal
         case ValueType::List:
         {
             os << "[";
-            for (auto it=V.const_list().begin(), it_end=V.const_list().end(); it != it_end; ++it)
+            for (auto it=V.listData(), it_end=V.listData() + V.listSize(); it != it_end; ++it)
             {
                 if (it->valueType() == ValueType::String)
                     os << "\"" << (*it) << "\"";
@@ -150,6 +253,24 @@ namespace Ark::internal
             os << V.usertype();
             break;
 
+        case ValueType::Dict:
+            os << V.const_dict();
+            break;
+
+        case ValueType::Array:
+        {
+            // printed as the expression creating it
+            os << "(array";
+            for (double d : V.const_array())
+                os << " " << Value(d);
+            os << ")";
+            break;
+        }
+
+        case ValueType::Range:
+            os << V.const_range();
+            break;
+
         case ValueType::Nil:
             os << "nil";
             break;
@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <iostream>
+#include <fstream>
 
 #include <clipp.hpp>
 #include <Ark/Ark.hpp>
@@ -25,8 +26,9 @@ int main(int argc, char** argv)
     enum class mode { help, dev_info, bytecode_reader, version, run, repl, compile, eval };
     mode selected = mode::repl;
 
-    std::string file = "", lib_dir = "?", eval_expresion = "";
-    unsigned debug = 0;
+    std::string file = "", lib_dir = "?", eval_expresion = "", profile_output = "", samples_output = "";
+    unsigned debug = 0, sampling_rate = 1000;
+    bool profile = false;
     std::vector<std::string> wrong, script_args;
     uint16_t options = Ark::DefaultFeatures;
 
@@ -57,6 +59,20 @@ int main(int argc, char** argv)
                     option("-L", "--lib").doc("Set the location of the ArkScript standard library")
                     & value("lib_dir", lib_dir)
                 ),
+                // profiling
+                option("--profile").set(profile).doc("Display statistics about the execution of the program, per function and per instruction"),
+                (
+                    option("--profile-json").set(profile).doc("Write the execution statistics as JSON to the given file")
+                    & value("json_file", profile_output)
+                ),
+                (
+                    option("--sample").doc("Sample the call stack and write it to the given file, in the collapsed format of flamegraph.pl")
+                    & value("folded_file", samples_output)
+                ),
+                (
+                    option("--sample-rate").doc("Number of samples per second (default: 1000)")
+                    & integer("rate", sampling_rate)
+                ),
                 // feature flags
                 with_prefix("-f",
                     // a single feature should always be defined with an ON and an OFF version, and documentation
@@ -66,6 +82,10 @@ int main(int argc, char** argv)
                     | option("no-fac").call([&]{ options &= ~Ark::FeatureFunctionArityCheck; })
                     ).doc("Toggle function arity checks (default: ON)")
                     ,
+                    ( option("bo"   ).call([&]{ options |= Ark::FeatureBufferedOutput; })
+                    | option("no-bo").call([&]{ options &= ~Ark::FeatureBufferedOutput; })
+                    ).doc("Buffer the output of print and puts until io:flush, input or the end of the program (default: OFF)")
+                    ,
                     ( option("ruv"   ).call([&]{ options |= Ark::FeatureRemoveUnusedVars; })
                     | option("no-ruv").call([&]{ options &= ~Ark::FeatureRemoveUnusedVars; })
                     ).doc("Remove unused variables (default: ON)")
@@ -110,6 +130,7 @@ int main(int argc, char** argv)
                 std::cout << "      sizeof(ValueType) = " << sizeof(Ark::internal::ValueType) << "B\n";
                 std::cout << "      sizeof(ProcType)  = " << sizeof(Ark::internal::Value::ProcType) << "B\n";
                 std::cout << "sizeof(Ark::Frame)    = " << sizeof(Ark::internal::Frame) << "B\n";
+                std::cout << "sizeof(Ark::Scope)    = " << sizeof(Ark::internal::Scope) << "B\n";
                 std::cout << "sizeof(Ark::State)    = " << sizeof(Ark::State) << "B\n";
                 std::cout << "sizeof(Ark::Closure)  = " << sizeof(Ark::internal::Closure) << "B\n";
                 std::cout << "sizeof(Ark::UserType) = " << sizeof(Ark::UserType) << "B\n";
@@ -156,7 +177,29 @@ int main(int argc, char** argv)
                 }
 
                 Ark::VM vm(&state);
-                return vm.run();
+                if (!profile && samples_output.empty())
+                    return vm.run();
+
+                if (profile)
+                    vm.enableProfiler();
+                if (!samples_output.empty())
+                    vm.enableSampler(sampling_rate);
+                int exit_code = vm.run();
+
+                if (profile && profile_output.empty())
+                    vm.displayProfile(std::cerr);
+                else if (profile)
+                {
+                    std::ofstream output(profile_output);
+                    vm.displayProfile(output, /* json */ true);
+                }
+
+                if (!samples_output.empty())
+                {
+                    std::ofstream output(samples_output);
+                    vm.writeSamples(output);
+                }
+                return exit_code;
             }
 
             case mode::eval:
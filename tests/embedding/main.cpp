@@ -0,0 +1,107 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <Ark/Ark.hpp>
+
+// tests of the API used by the programs embedding ArkScript and by the plugins
+
+namespace
+{
+    unsigned failures = 0;
+
+    void check(bool condition, const std::string& message)
+    {
+        if (!condition)
+        {
+            std::cerr << "FAILED: " << message << "\n";
+            ++failures;
+        }
+    }
+
+    std::vector<double> numbers(const Ark::internal::Value& list)
+    {
+        std::vector<double> output;
+        for (const Ark::internal::Value& value : list.const_list())
+            output.push_back(value.number());
+        return output;
+    }
+
+    // called like a plugin function, with the arguments copied in a vector
+    Ark::internal::Value readNested(std::vector<Ark::internal::Value>& n, Ark::VM*)
+    {
+        const auto& outer = n[0].const_list();
+        check(numbers(outer[0]) == std::vector<double>({ 2, 3 }), "plugin argument holding a tailOf result");
+        check(numbers(outer[1].const_list()[0]) == std::vector<double>({ 5, 6 }), "plugin argument holding a nested tailOf result");
+        check(numbers(outer[2]) == std::vector<double>({ 7, 8 }), "plugin argument holding a headOf result");
+        return Ark::internal::Value(static_cast<int>(outer.size()));
+    }
+
+    void testListViews()
+    {
+        using Ark::internal::Value;
+
+        // the variables are only read by the host, they must not be removed
+        Ark::State state(Ark::FeatureFunctionArityCheck);
+        state.loadFunction("read-nested", readNested);
+        // the compiler doesn't know the functions bound by the host, the symbol is declared without running the declaration
+        bool compiled = state.doString(
+            "(if false (let read-nested nil))\n"
+            "(let l [1 2 3])\n"
+            "(let tail (tailOf l))\n"
+            "(let nested (fun (xs) [(tailOf xs) [(headOf xs)]]))\n"
+            "(let size (read-nested [(tailOf l) [(tailOf [4 5 6])] (headOf [7 8 9])]))\n");
+        check(compiled, "compiling the views test");
+        if (!compiled)
+            return;
+
+        Ark::VM vm(&state);
+        check(vm.run() == 0, "running the views test");
+        check(vm["size"].number() == 3, "plugin function result");
+        check(numbers(vm["tail"]) == std::vector<double>({ 2, 3 }), "VM::operator[] giving a tailOf result");
+
+        Value list(Ark::internal::ValueType::List);
+        for (int i = 1; i <= 4; ++i)
+            list.push_back(Value(i));
+        Value result = vm.call("nested", list);
+        check(numbers(result.const_list()[0]) == std::vector<double>({ 2, 3, 4 }), "VM::call giving a tailOf result");
+        check(numbers(result.const_list()[1].const_list()[0]) == std::vector<double>({ 1, 2, 3 }), "VM::call giving a nested headOf result");
+    }
+
+    Ark::internal::Value twice(std::vector<Ark::internal::Value>& n, Ark::VM*)
+    {
+        return Ark::internal::Value(n[0].number() * 2);
+    }
+
+    void testIncremental()
+    {
+        // run like the REPL does, one piece of code at a time
+        Ark::State state(Ark::FeatureFunctionArityCheck);
+        state.loadFunction("twice", twice);
+        Ark::VM vm(&state);
+
+        check(state.doStringIncremental("(let a 1)"), "compiling the first incremental code");
+        check(vm.runIncremental() == 0, "running the first incremental code");
+        // the bound function is used for the first time by the second piece of code, its symbol didn't exist during the first run
+        check(state.doStringIncremental("(if false (let twice nil))\n(let b (twice 2))"), "compiling the second incremental code");
+        check(vm.runIncremental() == 0, "running the second incremental code");
+        check(vm["b"].number() == 4, "bound function used for the first time by an incremental code");
+        check(state.doStringIncremental("(let c (+ a b))"), "compiling the third incremental code");
+        check(vm.runIncremental() == 0, "running the third incremental code");
+        check(vm["c"].number() == 5, "variables kept between the incremental runs");
+    }
+}
+
+int main()
+{
+    testListViews();
+    testIncremental();
+
+    if (failures != 0)
+    {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "All the embedding tests passed\n";
+    return 0;
+}